@@ -0,0 +1,186 @@
+/**
+ * @file bench_patterns.cpp
+ * @brief Host-side benchmark of every LEDPatterns pattern
+ *
+ * Renders each PatternType at several strip lengths on a virtual clock that
+ * advances 20 ms per frame, so throttled patterns (rainbow, fire) do their
+ * full update on every frame and the numbers are worst case. Reports the
+ * mean time per frame and per LED, and the time per frame with the same
+ * strip length fixed at compile time (FixedLEDPatterns<N>). The last two
+ * rows are a cross-fade and a base pattern with two layers over it.
+ *
+ * Pattern output is checked by the unit tests in test/test_golden (pio
+ * test -e native). This program also records their golden frames.
+ *
+ * Build and run with: pio run -e native && .pio/build/native/program
+ * Record new golden frames with:
+ *     .pio/build/native/program --update-golden > test/test_golden/golden_frames.h
+ */
+
+#include <LEDPatterns.h>
+
+#include "golden.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+namespace {
+
+constexpr uint16_t BENCH_LED_COUNTS[] = { 150, 600, 2000 };
+const uint16_t BENCH_MAX_LEDS = 2000;
+
+const uint32_t FRAME_STEP_US = 20000;        // Virtual time between frames
+const uint32_t WARMUP_FRAMES = 20;           // Frames rendered before timing starts
+const uint32_t MIN_FRAMES = 100;             // Timed frames per measurement, at least
+const double MIN_MEASURE_SECONDS = 0.2;      // Wall time per measurement, at least
+
+// Field sources benchmarked, spread evenly along the strip
+const uint8_t BENCH_FIELD_SOURCES = 4;
+const uint8_t BENCH_FIELD_LEVELS[BENCH_FIELD_SOURCES] = { 255, 64, 180, 0 };
+
+CRGB leds[BENCH_MAX_LEDS];
+uint32_t virtualTimeUs = 0;
+volatile uint32_t sink = 0;
+
+uint32_t virtualClock() {
+    return virtualTimeUs;
+}
+
+/**
+ * Parameters each pattern is benchmarked with (what main.cpp uses at mid intensity)
+ */
+PatternParams benchParams(PatternType type) {
+    PatternParams params;
+    params.color = CHSV(96, 255, 255);
+    params.secondaryColor = CHSV(160, 128, 64);
+    params.speed = 20;
+    if (type == PATTERN_TWINKLE) {
+        params.chance = 25;
+    }
+    params.levels = BENCH_FIELD_LEVELS;
+    return params;
+}
+
+void advanceFrame() {
+    virtualTimeUs += FRAME_STEP_US;
+}
+
+/**
+ * Render frames of one pattern until enough time has passed, return ns per frame
+ */
+double measure(LEDPatternsBase& patterns, PatternType type, PatternType fadeFrom) {
+    const PatternParams params = benchParams(type);
+    const PatternParams fadeParams = benchParams(fadeFrom);
+
+    // With a fade source, keep a cross-fade from it running for every frame
+    bool fading = fadeFrom != type;
+
+    for (uint32_t i = 0; i < WARMUP_FRAMES; i++) {
+        advanceFrame();
+        patterns.render(type, params);
+    }
+
+    uint32_t frames = 0;
+    double elapsed = 0;
+    auto start = std::chrono::steady_clock::now();
+    do {
+        for (uint32_t i = 0; i < MIN_FRAMES; i++) {
+            if (fading && !patterns.isTransitioning()) {
+                patterns.render(fadeFrom, fadeParams);
+            }
+            advanceFrame();
+            patterns.render(type, params);
+            sink += leds[frames % patterns.getNumLeds()].r;
+            frames++;
+        }
+        elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    } while (elapsed < MIN_MEASURE_SECONDS);
+
+    return elapsed * 1e9 / frames;
+}
+
+// One row per pattern, plus the cross-fade and the layers
+const uint8_t BENCH_ROWS = NUM_PATTERNS + 2;
+
+/**
+ * Time every pattern and a cross-fade on one instance, in ns per frame
+ */
+void measureAll(LEDPatternsBase& patterns, double (&nsPerFrame)[BENCH_ROWS]) {
+    const uint16_t numLeds = patterns.getNumLeds();
+    patterns.setClock(virtualClock);
+
+    uint16_t positions[BENCH_FIELD_SOURCES];
+    for (uint8_t s = 0; s < BENCH_FIELD_SOURCES; s++) {
+        positions[s] = numLeds * (2 * s + 1) / (2 * BENCH_FIELD_SOURCES);
+    }
+    patterns.setFieldSources(positions, BENCH_FIELD_SOURCES, numLeds / (2 * BENCH_FIELD_SOURCES));
+
+    for (uint8_t i = 0; i < NUM_PATTERNS; i++) {
+        PatternType type = (PatternType)i;
+        nsPerFrame[i] = measure(patterns, type, type);
+    }
+
+    // Cross-fade cost: two renders plus the blend pass
+    patterns.setTransitionTime(UINT16_MAX);
+    nsPerFrame[NUM_PATTERNS] = measure(patterns, PATTERN_FIRE, PATTERN_PULSE);
+    patterns.setTransitionTime(0);
+
+    // Layering cost: breathing with sparkles added and a chase screened over
+    // it, three renders plus the composite pass
+    TwinklePattern sparklePattern;
+    ChasePattern chasePattern;
+    int8_t sparkles = patterns.addLayer(sparklePattern);
+    int8_t chaser = patterns.addLayer(chasePattern);
+    if (sparkles < 0 || chaser < 0) {
+        nsPerFrame[NUM_PATTERNS + 1] = 0;
+        return;
+    }
+    patterns.setLayer(sparkles, benchParams(PATTERN_TWINKLE), BLEND_ADD);
+    patterns.setLayer(chaser, benchParams(PATTERN_CHASE), BLEND_SCREEN, 192);
+    nsPerFrame[NUM_PATTERNS + 1] = measure(patterns, PATTERN_BREATHING, PATTERN_BREATHING);
+    patterns.hideLayer(sparkles);
+    patterns.hideLayer(chaser);
+}
+
+/**
+ * Benchmark one strip length with LEDPatterns and FixedLEDPatterns<N>
+ */
+template <uint16_t N>
+void benchLength() {
+    double runtime[BENCH_ROWS];
+    double fixed[BENCH_ROWS];
+    {
+        LEDPatterns patterns(leds, N);
+        measureAll(patterns, runtime);
+    }
+    {
+        FixedLEDPatterns<N> patterns(leds);
+        measureAll(patterns, fixed);
+    }
+
+    for (uint8_t i = 0; i < BENCH_ROWS; i++) {
+        const char* name = i < NUM_PATTERNS ? patternName((PatternType)i) : i == NUM_PATTERNS ? "pulse>fire" : "layers";
+        printf("%-12s %6u %12.0f %10.2f %12.0f\n", name, N, runtime[i], runtime[i] / N, fixed[i]);
+    }
+}
+
+} // namespace
+
+// The unit test runner brings its own main()
+#ifndef PIO_UNIT_TESTING
+int main(int argc, char** argv) {
+    if (argc > 1 && strcmp(argv[1], "--update-golden") == 0) {
+        printGoldenFrames();
+        return 0;
+    }
+
+    printf("%-12s %6s %12s %10s %12s\n", "pattern", "leds", "ns/frame", "ns/led", "fixed<N>");
+
+    benchLength<BENCH_LED_COUNTS[0]>();
+    benchLength<BENCH_LED_COUNTS[1]>();
+    benchLength<BENCH_LED_COUNTS[2]>();
+
+    return 0;
+}
+#endif // PIO_UNIT_TESTING
@@ -0,0 +1,212 @@
+/**
+ * @file golden.cpp
+ * @brief Golden-frame scenarios for LEDPatterns
+ */
+
+#include "golden.h"
+
+#include <cstdio>
+#include <cstring>
+
+namespace {
+
+const uint32_t GOLDEN_START_US = 1000000;
+const uint32_t GOLDEN_FRAME_STEP_US = 16000;  // Not a multiple of 20 ms, so throttled patterns skip frames
+const uint16_t GOLDEN_RANDOM_SEED = 1;
+const uint16_t GOLDEN_TRANSITION_MS = 400;
+
+// Field sources, at 1/6, 1/2 and 5/6 of the strip
+const uint8_t GOLDEN_FIELD_SOURCES = 3;
+
+CRGB leds[GOLDEN_MAX_LEDS];
+uint32_t goldenTimeUs = 0;
+uint8_t goldenLevels[GOLDEN_FIELD_SOURCES];
+
+uint32_t goldenClock() {
+    return goldenTimeUs;
+}
+
+/**
+ * Fixed parameters for the scenarios; changing them invalidates golden_frames.h
+ */
+PatternParams goldenParams() {
+    PatternParams params;
+    params.color = CHSV(40, 230, 255);
+    params.secondaryColor = CHSV(170, 128, 64);
+    params.speed = 30;
+    params.size = 4;
+    params.cooling = 60;
+    params.sparking = 120;
+    params.chance = 30;
+    params.levels = goldenLevels;
+    return params;
+}
+
+/**
+ * FNV-1a over the LED buffer, continuing from a previous hash
+ */
+uint32_t hashFrame(uint32_t hash, uint16_t numLeds) {
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(leds);
+    for (size_t i = 0; i < numLeds * sizeof(CRGB); i++) {
+        hash = (hash ^ bytes[i]) * 16777619u;
+    }
+    return hash;
+}
+
+/**
+ * Pattern shown at a frame of the transitions scenario: cross-fades, a
+ * reversal mid-fade, and a third pattern interrupting a fade
+ */
+PatternType transitionPattern(uint16_t frame) {
+    if (frame < 40) return PATTERN_PULSE;
+    if (frame < 50) return PATTERN_FIRE;       // Fade to fire...
+    if (frame < 100) return PATTERN_PULSE;     // ...reversed before it completes
+    if (frame < 110) return PATTERN_CHASE;
+    if (frame < 180) return PATTERN_TWINKLE;   // Interrupts the fade to chase
+    return PATTERN_RAINBOW;
+}
+
+/**
+ * Layers shown at a frame of the layers scenario: sparkles fading in over
+ * the transitions, a chase cycling through every blend mode, and both
+ * layers hidden for a while so the base is shown on its own again
+ */
+void showLayers(LEDPatternsBase& patterns, int8_t sparkles, int8_t chaser, uint16_t frame) {
+    if (frame < 20 || (frame >= 150 && frame < 170)) {
+        patterns.hideLayer(sparkles);
+        patterns.hideLayer(chaser);
+        return;
+    }
+
+    PatternParams sparkleParams = goldenParams();
+    sparkleParams.color = CHSV(0, 0, 255);
+    patterns.setLayer(sparkles, sparkleParams, BLEND_ADD, min(255, (frame - 20) * 8));
+
+    if (frame < 60) {
+        patterns.hideLayer(chaser);
+        return;
+    }
+    PatternParams chaseParams = goldenParams();
+    chaseParams.color = CHSV(200, 255, 255);
+    chaseParams.count = 3;
+    patterns.setLayer(chaser, chaseParams, (BlendMode)((frame / 20) % NUM_BLEND_MODES), 192);
+}
+
+/**
+ * Render one scenario on a fresh instance, keeping the hash and samples
+ */
+bool runCase(LEDPatternsBase& patterns, int type, uint16_t numLeds, GoldenRun& run) {
+    fill_solid(leds, GOLDEN_MAX_LEDS, CRGB::Black);
+    goldenTimeUs = GOLDEN_START_US;
+
+    patterns.setClock(goldenClock);
+    patterns.setRandomSeed(GOLDEN_RANDOM_SEED);
+
+    uint16_t positions[GOLDEN_FIELD_SOURCES];
+    for (uint8_t s = 0; s < GOLDEN_FIELD_SOURCES; s++) {
+        positions[s] = numLeds * (2 * s + 1) / (2 * GOLDEN_FIELD_SOURCES);
+    }
+    patterns.setFieldSources(positions, GOLDEN_FIELD_SOURCES, numLeds / 12);
+    if (type >= GOLDEN_TRANSITIONS) {
+        patterns.setTransitionTime(GOLDEN_TRANSITION_MS);
+    }
+
+    // Layer patterns for the layers scenario, one instance per layer
+    TwinklePattern sparklePattern;
+    ChasePattern chasePattern;
+    int8_t sparkles = -1;
+    int8_t chaser = -1;
+    if (type == GOLDEN_LAYERS) {
+        sparkles = patterns.addLayer(sparklePattern);
+        chaser = patterns.addLayer(chasePattern);
+        if (sparkles < 0 || chaser < 0) {
+            return false;
+        }
+    }
+
+    run.hash = 2166136261u;
+    for (uint16_t frame = 0; frame < GOLDEN_FRAMES_PER_CASE; frame++) {
+        // Field levels ramp up and down out of phase with each other
+        for (uint8_t s = 0; s < GOLDEN_FIELD_SOURCES; s++) {
+            uint8_t phase = frame * 3 + s * 85;
+            goldenLevels[s] = phase < 128 ? phase * 2 : (255 - phase) * 2;
+        }
+
+        if (type == GOLDEN_LAYERS) {
+            showLayers(patterns, sparkles, chaser, frame);
+        }
+
+        PatternType shown = type >= GOLDEN_TRANSITIONS ? transitionPattern(frame) : (PatternType)type;
+        patterns.render(shown, goldenParams());
+        run.hash = hashFrame(run.hash, numLeds);
+        if ((frame + 1) % GOLDEN_SAMPLE_INTERVAL == 0) {
+            memcpy(run.samples[frame / GOLDEN_SAMPLE_INTERVAL], leds, numLeds * sizeof(CRGB));
+        }
+        goldenTimeUs += GOLDEN_FRAME_STEP_US;
+    }
+    return true;
+}
+
+/**
+ * The same scenario through FixedLEDPatterns<N>
+ */
+template <uint16_t N>
+bool runFixedCase(int type, GoldenRun& run) {
+    FixedLEDPatterns<N> patterns(leds);
+    return runCase(patterns, type, N, run);
+}
+
+/**
+ * Print a frame as a C string of hex digits, split over several lines
+ */
+void printSample(const CRGB* frame, uint16_t numLeds) {
+    const uint16_t LEDS_PER_LINE = 32;
+    for (uint16_t i = 0; i < numLeds; i++) {
+        if (i % LEDS_PER_LINE == 0) {
+            printf("%s\n          \"", i == 0 ? "" : "\"");
+        }
+        printf("%02x%02x%02x", frame[i].r, frame[i].g, frame[i].b);
+    }
+    printf("\"");
+}
+
+GoldenRun printRun;
+
+} // namespace
+
+const char* goldenScenarioName(int scenario) {
+    if (scenario == GOLDEN_TRANSITIONS) return "transitions";
+    if (scenario == GOLDEN_LAYERS) return "layers";
+    return patternName((PatternType)scenario);
+}
+
+bool runGoldenScenario(int scenario, uint16_t numLeds, bool fixed, GoldenRun& run) {
+    static_assert(GOLDEN_LENGTHS == 2, "One FixedLEDPatterns per strip length");
+    if (fixed) {
+        return numLeds == GOLDEN_LED_COUNTS[0] ? runFixedCase<GOLDEN_LED_COUNTS[0]>(scenario, run)
+                                               : runFixedCase<GOLDEN_LED_COUNTS[1]>(scenario, run);
+    }
+    LEDPatterns patterns(leds, numLeds);
+    return runCase(patterns, scenario, numLeds, run);
+}
+
+void printGoldenFrames() {
+    printf("// Generated by: .pio/build/native/program --update-golden\n");
+    printf("// Only regenerate after checking that a change in output is intended.\n");
+    printf("const GoldenCase GOLDEN_FRAMES[] = {\n");
+
+    for (uint16_t numLeds : GOLDEN_LED_COUNTS) {
+        for (int scenario = 0; scenario < GOLDEN_SCENARIOS; scenario++) {
+            if (!runGoldenScenario(scenario, numLeds, false, printRun)) {
+                continue;
+            }
+            printf("    { \"%s\", %u, 0x%08x, {", goldenScenarioName(scenario), numLeds, printRun.hash);
+            for (uint8_t sample = 0; sample < GOLDEN_SAMPLES; sample++) {
+                printSample(printRun.samples[sample], numLeds);
+                printf("%s", sample + 1 < GOLDEN_SAMPLES ? "," : "");
+            }
+            printf(" } },\n");
+        }
+    }
+    printf("};\n");
+}
@@ -0,0 +1,82 @@
+/**
+ * @file golden.h
+ * @brief Golden-frame scenarios for LEDPatterns
+ *
+ * Every pattern, plus a transitions and a layers scenario, is rendered
+ * through a fixed sequence of frames on a virtual clock with a fixed random
+ * seed, so the output is the same on every run. A run returns a hash of
+ * every frame and a copy of the frames at GOLDEN_SAMPLE_INTERVAL steps.
+ *
+ * The unit tests in test/test_golden compare runs against the frames
+ * recorded in test/test_golden/golden_frames.h, within a per-channel
+ * tolerance, and check that FixedLEDPatterns<N> renders exactly what
+ * LEDPatterns does. The benchmark program prints a fresh golden_frames.h
+ * with --update-golden.
+ */
+
+#ifndef GOLDEN_H
+#define GOLDEN_H
+
+#include <LEDPatterns.h>
+
+/**
+ * @brief Strip lengths every scenario is rendered at
+ */
+constexpr uint16_t GOLDEN_LED_COUNTS[] = { 150, 600 };
+const uint8_t GOLDEN_LENGTHS = sizeof(GOLDEN_LED_COUNTS) / sizeof(GOLDEN_LED_COUNTS[0]);
+const uint16_t GOLDEN_MAX_LEDS = 600;
+
+/**
+ * @brief Scenarios: one per PatternType, then transitions and layers
+ */
+const int GOLDEN_TRANSITIONS = NUM_PATTERNS;
+const int GOLDEN_LAYERS = NUM_PATTERNS + 1;
+const int GOLDEN_SCENARIOS = NUM_PATTERNS + 2;
+
+/**
+ * @brief Frames rendered per scenario, and every how many a copy is kept
+ */
+const uint16_t GOLDEN_FRAMES_PER_CASE = 240;
+const uint16_t GOLDEN_SAMPLE_INTERVAL = 60;
+const uint8_t GOLDEN_SAMPLES = GOLDEN_FRAMES_PER_CASE / GOLDEN_SAMPLE_INTERVAL;
+
+/**
+ * @brief Output of one scenario
+ */
+struct GoldenRun {
+    uint32_t hash;                                   // Hash of every frame
+    CRGB samples[GOLDEN_SAMPLES][GOLDEN_MAX_LEDS];   // Last frame of each sample interval
+};
+
+/**
+ * @brief Recorded output of one scenario (golden_frames.h)
+ */
+struct GoldenCase {
+    const char* name;                     // Scenario name
+    uint16_t numLeds;                     // Strip length
+    uint32_t hash;                        // Hash of every frame
+    const char* samples[GOLDEN_SAMPLES];  // Sampled frames in hex, rrggbb per LED
+};
+
+/**
+ * @brief Name of a scenario, as recorded in golden_frames.h
+ */
+const char* goldenScenarioName(int scenario);
+
+/**
+ * @brief Render one scenario on a fresh instance
+ *
+ * @param scenario 0 to GOLDEN_SCENARIOS - 1
+ * @param numLeds One of GOLDEN_LED_COUNTS
+ * @param fixed Render through FixedLEDPatterns<numLeds> instead of LEDPatterns
+ * @param run Receives the hash and samples
+ * @return false if the scenario couldn't be set up (arena too small)
+ */
+bool runGoldenScenario(int scenario, uint16_t numLeds, bool fixed, GoldenRun& run);
+
+/**
+ * @brief Print a fresh golden_frames.h to stdout
+ */
+void printGoldenFrames();
+
+#endif // GOLDEN_H
@@ -0,0 +1,35 @@
+/**
+ * @file Arduino.h
+ * @brief Minimal Arduino core shim for host-side builds of the LEDPatterns library
+ *
+ * Only the pieces the library touches are provided. Time is taken from
+ * the host's monotonic clock so millis()/micros() behave like the real core.
+ */
+
+#ifndef ARDUINO_SHIM_H
+#define ARDUINO_SHIM_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#ifdef __cplusplus
+#include <algorithm>
+#include <cmath>
+
+using std::abs;
+using std::max;
+using std::min;
+#endif
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+uint32_t millis();
+uint32_t micros();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+
+long map(long x, long in_min, long in_max, long out_min, long out_max);
+
+#endif // ARDUINO_SHIM_H
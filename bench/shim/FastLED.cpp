@@ -0,0 +1,294 @@
+/**
+ * @file FastLED.cpp
+ * @brief Host implementations for the FastLED and Arduino shims
+ */
+
+#include <FastLED.h>
+
+#include <chrono>
+#include <thread>
+
+CFastLED FastLED;
+uint16_t rand16seed = 1337;
+
+namespace {
+
+const std::chrono::steady_clock::time_point kStartTime = std::chrono::steady_clock::now();
+
+} // namespace
+
+uint32_t millis() {
+    return (uint32_t)std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - kStartTime).count();
+}
+
+uint32_t micros() {
+    return (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - kStartTime).count();
+}
+
+void delay(uint32_t ms) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+void delayMicroseconds(uint32_t us) {
+    std::this_thread::sleep_for(std::chrono::microseconds(us));
+}
+
+long map(long x, long in_min, long in_max, long out_min, long out_max) {
+    const long dividend = out_max - out_min;
+    const long divisor = in_max - in_min;
+    const long delta = x - in_min;
+    if (divisor == 0) {
+        return -1;
+    }
+    return (delta * dividend + (divisor / 2)) / divisor + out_min;
+}
+
+/**
+ * hsv2rgb_rainbow from FastLED (Y1 yellow boost, no green scaling)
+ */
+void hsv2rgb_rainbow(const CHSV& hsv, CRGB& rgb) {
+    const uint8_t K255 = 255;
+    const uint8_t K171 = 171;
+    const uint8_t K170 = 170;
+    const uint8_t K85 = 85;
+
+    uint8_t hue = hsv.hue;
+    uint8_t sat = hsv.sat;
+    uint8_t val = hsv.val;
+
+    uint8_t offset8 = (hue & 0x1F) << 3;
+    uint8_t third = scale8(offset8, (256 / 3));
+    uint8_t twothirds = scale8(offset8, ((256 * 2) / 3));
+
+    uint8_t r, g, b;
+
+    if (!(hue & 0x80)) {
+        if (!(hue & 0x40)) {
+            if (!(hue & 0x20)) {
+                r = K255 - third;
+                g = third;
+                b = 0;
+            } else {
+                r = K171;
+                g = K85 + third;
+                b = 0;
+            }
+        } else {
+            if (!(hue & 0x20)) {
+                r = K171 - twothirds;
+                g = K170 + third;
+                b = 0;
+            } else {
+                r = 0;
+                g = K255 - third;
+                b = third;
+            }
+        }
+    } else {
+        if (!(hue & 0x40)) {
+            if (!(hue & 0x20)) {
+                r = 0;
+                g = K171 - twothirds;
+                b = K85 + twothirds;
+            } else {
+                r = third;
+                g = 0;
+                b = K255 - third;
+            }
+        } else {
+            if (!(hue & 0x20)) {
+                r = K85 + third;
+                g = 0;
+                b = K171 - third;
+            } else {
+                r = K170 + third;
+                g = 0;
+                b = K85 - third;
+            }
+        }
+    }
+
+    if (sat != 255) {
+        if (sat == 0) {
+            r = 255;
+            b = 255;
+            g = 255;
+        } else {
+            uint8_t desat = 255 - sat;
+            desat = scale8_video(desat, desat);
+            uint8_t satscale = 255 - desat;
+            r = scale8(r, satscale);
+            g = scale8(g, satscale);
+            b = scale8(b, satscale);
+            r += desat;
+            g += desat;
+            b += desat;
+        }
+    }
+
+    if (val != 255) {
+        val = scale8_video(val, val);
+        if (val == 0) {
+            r = 0;
+            g = 0;
+            b = 0;
+        } else {
+            r = scale8(r, val);
+            g = scale8(g, val);
+            b = scale8(b, val);
+        }
+    }
+
+    rgb.r = r;
+    rgb.g = g;
+    rgb.b = b;
+}
+
+void fill_solid(CRGB* leds, int numToFill, const CRGB& color) {
+    for (int i = 0; i < numToFill; ++i) {
+        leds[i] = color;
+    }
+}
+
+void fill_solid(CRGB* leds, int numToFill, const CHSV& color) {
+    fill_solid(leds, numToFill, CRGB(color));
+}
+
+void fill_rainbow(CRGB* leds, int numToFill, uint8_t initialhue, uint8_t deltahue) {
+    CHSV hsv;
+    hsv.hue = initialhue;
+    hsv.val = 255;
+    hsv.sat = 240;
+    for (int i = 0; i < numToFill; ++i) {
+        leds[i] = hsv;
+        hsv.hue += deltahue;
+    }
+}
+
+void fill_gradient_HSV(CRGB* leds, uint16_t startpos, CHSV startcolor,
+                       uint16_t endpos, CHSV endcolor,
+                       TGradientDirectionCode directionCode) {
+    if (endpos < startpos) {
+        uint16_t t = endpos;
+        CHSV tc = endcolor;
+        endcolor = startcolor;
+        endpos = startpos;
+        startpos = t;
+        startcolor = tc;
+    }
+
+    if (endcolor.value == 0 || endcolor.saturation == 0) {
+        endcolor.hue = startcolor.hue;
+    }
+    if (startcolor.value == 0 || startcolor.saturation == 0) {
+        startcolor.hue = endcolor.hue;
+    }
+
+    saccum87 huedistance87;
+    saccum87 satdistance87 = (endcolor.sat - startcolor.sat) << 7;
+    saccum87 valdistance87 = (endcolor.val - startcolor.val) << 7;
+
+    uint8_t huedelta8 = endcolor.hue - startcolor.hue;
+
+    if (directionCode == SHORTEST_HUES) {
+        directionCode = huedelta8 > 127 ? BACKWARD_HUES : FORWARD_HUES;
+    }
+    if (directionCode == LONGEST_HUES) {
+        directionCode = huedelta8 < 128 ? BACKWARD_HUES : FORWARD_HUES;
+    }
+
+    if (directionCode == FORWARD_HUES) {
+        huedistance87 = huedelta8 << 7;
+    } else {
+        huedistance87 = (uint8_t)(256 - huedelta8) << 7;
+        huedistance87 = -huedistance87;
+    }
+
+    uint16_t pixeldistance = endpos - startpos;
+    int16_t divisor = pixeldistance ? pixeldistance : 1;
+
+    saccum87 huedelta87 = (huedistance87 / divisor) * 2;
+    saccum87 satdelta87 = (satdistance87 / divisor) * 2;
+    saccum87 valdelta87 = (valdistance87 / divisor) * 2;
+
+    accum88 hue88 = startcolor.hue << 8;
+    accum88 sat88 = startcolor.sat << 8;
+    accum88 val88 = startcolor.val << 8;
+    for (uint16_t i = startpos; i <= endpos; ++i) {
+        leds[i] = CHSV(hue88 >> 8, sat88 >> 8, val88 >> 8);
+        hue88 += huedelta87;
+        sat88 += satdelta87;
+        val88 += valdelta87;
+    }
+}
+
+void nscale8(CRGB* leds, uint16_t numLeds, uint8_t scale) {
+    for (uint16_t i = 0; i < numLeds; ++i) {
+        leds[i].nscale8(scale);
+    }
+}
+
+void fadeToBlackBy(CRGB* leds, uint16_t numLeds, uint8_t fadeBy) {
+    nscale8(leds, numLeds, 255 - fadeBy);
+}
+
+CRGB& nblend(CRGB& existing, const CRGB& overlay, fract8 amountOfOverlay) {
+    if (amountOfOverlay == 0) {
+        return existing;
+    }
+    if (amountOfOverlay == 255) {
+        existing = overlay;
+        return existing;
+    }
+
+    fract8 amountOfKeep = 255 - amountOfOverlay;
+    existing.red = scale8(existing.red, amountOfKeep) + scale8(overlay.red, amountOfOverlay);
+    existing.green = scale8(existing.green, amountOfKeep) + scale8(overlay.green, amountOfOverlay);
+    existing.blue = scale8(existing.blue, amountOfKeep) + scale8(overlay.blue, amountOfOverlay);
+    return existing;
+}
+
+void nblend(CRGB* existing, const CRGB* overlay, uint16_t count, fract8 amountOfOverlay) {
+    for (uint16_t i = 0; i < count; ++i) {
+        nblend(existing[i], overlay[i], amountOfOverlay);
+    }
+}
+
+CRGB blend(const CRGB& p1, const CRGB& p2, fract8 amountOfP2) {
+    CRGB nu(p1);
+    nblend(nu, p2, amountOfP2);
+    return nu;
+}
+
+CRGB* blend(const CRGB* src1, const CRGB* src2, CRGB* dest, uint16_t count, fract8 amountOfsrc2) {
+    for (uint16_t i = 0; i < count; ++i) {
+        dest[i] = blend(src1[i], src2[i], amountOfsrc2);
+    }
+    return dest;
+}
+
+CRGB HeatColor(uint8_t temperature) {
+    CRGB heatcolor;
+
+    uint8_t t192 = scale8_video(temperature, 191);
+    uint8_t heatramp = t192 & 0x3F;
+    heatramp <<= 2;
+
+    if (t192 & 0x80) {
+        heatcolor.r = 255;
+        heatcolor.g = 255;
+        heatcolor.b = heatramp;
+    } else if (t192 & 0x40) {
+        heatcolor.r = 255;
+        heatcolor.g = heatramp;
+        heatcolor.b = 0;
+    } else {
+        heatcolor.r = heatramp;
+        heatcolor.g = 0;
+        heatcolor.b = 0;
+    }
+
+    return heatcolor;
+}
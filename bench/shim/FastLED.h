@@ -0,0 +1,314 @@
+/**
+ * @file FastLED.h
+ * @brief Minimal FastLED shim for host-side builds of the LEDPatterns library
+ *
+ * Mirrors the FastLED 3.5 color types and lib8tion math the library uses,
+ * following the reference C implementations (FASTLED_SCALE8_FIXED=1), so
+ * kernels cost roughly what they cost on the device. The controller side
+ * is a no-op: show() never touches any hardware.
+ */
+
+#ifndef FASTLED_SHIM_H
+#define FASTLED_SHIM_H
+
+#include <Arduino.h>
+
+typedef uint8_t fract8;
+typedef uint16_t fract16;
+typedef uint16_t accum88;
+typedef int16_t saccum87;
+
+#define GET_MILLIS millis
+
+// ---------------------------------------------------------------------------
+// lib8tion
+// ---------------------------------------------------------------------------
+
+inline uint8_t scale8(uint8_t i, fract8 scale) {
+    return (((uint16_t)i) * (1 + (uint16_t)scale)) >> 8;
+}
+
+inline uint8_t scale8_video(uint8_t i, fract8 scale) {
+    return (((int)i * (int)scale) >> 8) + ((i && scale) ? 1 : 0);
+}
+
+inline uint16_t scale16by8(uint16_t i, fract8 scale) {
+    return (i * (1 + ((uint16_t)scale))) >> 8;
+}
+
+inline uint16_t scale16(uint16_t i, fract16 scale) {
+    return ((uint32_t)i * (1 + (uint32_t)scale)) / 65536;
+}
+
+inline uint8_t qadd8(uint8_t i, uint8_t j) {
+    unsigned int t = i + j;
+    return t > 255 ? 255 : t;
+}
+
+inline uint8_t qsub8(uint8_t i, uint8_t j) {
+    int t = i - j;
+    return t < 0 ? 0 : t;
+}
+
+inline uint8_t lerp8by8(uint8_t a, uint8_t b, fract8 frac) {
+    if (b > a) {
+        return a + scale8(b - a, frac);
+    }
+    return a - scale8(a - b, frac);
+}
+
+inline uint8_t map8(uint8_t in, uint8_t rangeStart, uint8_t rangeEnd) {
+    return rangeStart + scale8(in, rangeEnd - rangeStart);
+}
+
+inline uint8_t sin8(uint8_t theta) {
+    static const uint8_t b_m16_interleave[] = { 0, 49, 49, 41, 90, 27, 117, 10 };
+
+    uint8_t offset = theta;
+    if (theta & 0x40) {
+        offset = (uint8_t)255 - offset;
+    }
+    offset &= 0x3F;
+
+    uint8_t secoffset = offset & 0x0F;
+    if (theta & 0x40) {
+        ++secoffset;
+    }
+
+    uint8_t section = offset >> 4;
+    const uint8_t* p = b_m16_interleave + section * 2;
+    uint8_t b = p[0];
+    uint8_t m16 = p[1];
+    uint8_t mx = (m16 * secoffset) >> 4;
+
+    int8_t y = mx + b;
+    if (theta & 0x80) {
+        y = -y;
+    }
+    y += 128;
+    return y;
+}
+
+inline uint8_t cos8(uint8_t theta) {
+    return sin8(theta + 64);
+}
+
+// ---------------------------------------------------------------------------
+// Random numbers (same 16-bit LCG as FastLED)
+// ---------------------------------------------------------------------------
+
+extern uint16_t rand16seed;
+
+inline uint8_t random8() {
+    rand16seed = (rand16seed * 2053) + 13849;
+    return (uint8_t)(((uint8_t)(rand16seed & 0xFF)) + ((uint8_t)(rand16seed >> 8)));
+}
+
+inline uint8_t random8(uint8_t lim) {
+    uint8_t r = random8();
+    r = (r * lim) >> 8;
+    return r;
+}
+
+inline uint8_t random8(uint8_t min, uint8_t lim) {
+    uint8_t delta = lim - min;
+    return random8(delta) + min;
+}
+
+inline uint16_t random16() {
+    rand16seed = (rand16seed * 2053) + 13849;
+    return rand16seed;
+}
+
+inline uint16_t random16(uint16_t lim) {
+    uint16_t r = random16();
+    uint32_t p = (uint32_t)lim * (uint32_t)r;
+    return p >> 16;
+}
+
+inline void random16_set_seed(uint16_t seed) {
+    rand16seed = seed;
+}
+
+// ---------------------------------------------------------------------------
+// Beat generators
+// ---------------------------------------------------------------------------
+
+inline uint16_t beat88(accum88 beats_per_minute_88, uint32_t timebase = 0) {
+    return ((GET_MILLIS() - timebase) * beats_per_minute_88 * 280) >> 16;
+}
+
+inline uint16_t beat16(accum88 beats_per_minute, uint32_t timebase = 0) {
+    if (beats_per_minute < 256) {
+        beats_per_minute <<= 8;
+    }
+    return beat88(beats_per_minute, timebase);
+}
+
+inline uint8_t beat8(accum88 beats_per_minute, uint32_t timebase = 0) {
+    return beat16(beats_per_minute, timebase) >> 8;
+}
+
+inline uint8_t beatsin8(accum88 beats_per_minute, uint8_t lowest = 0, uint8_t highest = 255,
+                        uint32_t timebase = 0, uint8_t phase_offset = 0) {
+    uint8_t beat = beat8(beats_per_minute, timebase);
+    uint8_t beatsin = sin8(beat + phase_offset);
+    uint8_t rangewidth = highest - lowest;
+    uint8_t scaledbeat = scale8(beatsin, rangewidth);
+    return lowest + scaledbeat;
+}
+
+// ---------------------------------------------------------------------------
+// Color types
+// ---------------------------------------------------------------------------
+
+struct CHSV {
+    union {
+        struct {
+            union { uint8_t hue; uint8_t h; };
+            union { uint8_t saturation; uint8_t sat; uint8_t s; };
+            union { uint8_t value; uint8_t val; uint8_t v; };
+        };
+        uint8_t raw[3];
+    };
+
+    CHSV() : h(0), s(0), v(0) {}
+    CHSV(uint8_t ih, uint8_t is, uint8_t iv) : h(ih), s(is), v(iv) {}
+};
+
+struct CRGB;
+void hsv2rgb_rainbow(const CHSV& hsv, CRGB& rgb);
+
+struct CRGB {
+    union {
+        struct {
+            union { uint8_t r; uint8_t red; };
+            union { uint8_t g; uint8_t green; };
+            union { uint8_t b; uint8_t blue; };
+        };
+        uint8_t raw[3];
+    };
+
+    enum HTMLColorCode {
+        Black = 0x000000,
+        Blue = 0x0000FF,
+        Green = 0x008000,
+        Red = 0xFF0000,
+        White = 0xFFFFFF
+    };
+
+    CRGB() : r(0), g(0), b(0) {}
+    CRGB(uint8_t ir, uint8_t ig, uint8_t ib) : r(ir), g(ig), b(ib) {}
+    CRGB(uint32_t colorcode) : r((colorcode >> 16) & 0xFF), g((colorcode >> 8) & 0xFF), b(colorcode & 0xFF) {}
+    CRGB(HTMLColorCode colorcode) : CRGB((uint32_t)colorcode) {}
+    CRGB(const CHSV& rhs) { hsv2rgb_rainbow(rhs, *this); }
+
+    CRGB& operator=(const CHSV& rhs) {
+        hsv2rgb_rainbow(rhs, *this);
+        return *this;
+    }
+
+    uint8_t& operator[](uint8_t x) { return raw[x]; }
+    const uint8_t& operator[](uint8_t x) const { return raw[x]; }
+
+    CRGB& nscale8(uint8_t scaledown) {
+        r = scale8(r, scaledown);
+        g = scale8(g, scaledown);
+        b = scale8(b, scaledown);
+        return *this;
+    }
+
+    CRGB& nscale8_video(uint8_t scaledown) {
+        r = scale8_video(r, scaledown);
+        g = scale8_video(g, scaledown);
+        b = scale8_video(b, scaledown);
+        return *this;
+    }
+
+    CRGB& fadeToBlackBy(uint8_t fadefactor) {
+        return nscale8(255 - fadefactor);
+    }
+
+    CRGB& operator+=(const CRGB& rhs) {
+        r = qadd8(r, rhs.r);
+        g = qadd8(g, rhs.g);
+        b = qadd8(b, rhs.b);
+        return *this;
+    }
+};
+
+inline bool operator==(const CRGB& lhs, const CRGB& rhs) {
+    return lhs.r == rhs.r && lhs.g == rhs.g && lhs.b == rhs.b;
+}
+
+inline bool operator!=(const CRGB& lhs, const CRGB& rhs) {
+    return !(lhs == rhs);
+}
+
+// ---------------------------------------------------------------------------
+// Color utilities
+// ---------------------------------------------------------------------------
+
+enum TGradientDirectionCode {
+    FORWARD_HUES,
+    BACKWARD_HUES,
+    SHORTEST_HUES,
+    LONGEST_HUES
+};
+
+void fill_solid(CRGB* leds, int numToFill, const CRGB& color);
+void fill_solid(CRGB* leds, int numToFill, const CHSV& color);
+void fill_rainbow(CRGB* leds, int numToFill, uint8_t initialhue, uint8_t deltahue = 5);
+void fill_gradient_HSV(CRGB* leds, uint16_t startpos, CHSV startcolor,
+                       uint16_t endpos, CHSV endcolor,
+                       TGradientDirectionCode directionCode = SHORTEST_HUES);
+void nscale8(CRGB* leds, uint16_t numLeds, uint8_t scale);
+void fadeToBlackBy(CRGB* leds, uint16_t numLeds, uint8_t fadeBy);
+CRGB& nblend(CRGB& existing, const CRGB& overlay, fract8 amountOfOverlay);
+void nblend(CRGB* existing, const CRGB* overlay, uint16_t count, fract8 amountOfOverlay);
+CRGB blend(const CRGB& p1, const CRGB& p2, fract8 amountOfP2);
+CRGB* blend(const CRGB* src1, const CRGB* src2, CRGB* dest, uint16_t count, fract8 amountOfsrc2);
+CRGB HeatColor(uint8_t temperature);
+
+// ---------------------------------------------------------------------------
+// Controller stand-ins
+// ---------------------------------------------------------------------------
+
+enum EOrder { RGB = 0012, GRB = 0102 };
+enum EDitherMode { DISABLE_DITHER = 0x00, BINARY_DITHER = 0x01 };
+
+class CLEDController {
+public:
+    CLEDController& setDither(uint8_t ditherMode = BINARY_DITHER) {
+        (void)ditherMode;
+        return *this;
+    }
+};
+
+template <uint8_t DATA_PIN, EOrder RGB_ORDER = GRB>
+class WS2812B {};
+
+class CFastLED {
+public:
+    template <template <uint8_t DATA_PIN, EOrder RGB_ORDER> class CHIPSET, uint8_t DATA_PIN, EOrder RGB_ORDER>
+    CLEDController& addLeds(CRGB* data, int nLedsOrOffset, int nLedsIfOffset = 0) {
+        (void)data;
+        (void)nLedsOrOffset;
+        (void)nLedsIfOffset;
+        static CLEDController controller;
+        return controller;
+    }
+
+    void setBrightness(uint8_t scale) { _brightness = scale; }
+    uint8_t getBrightness() const { return _brightness; }
+    void setDither(uint8_t ditherMode = BINARY_DITHER) { (void)ditherMode; }
+    void show() {}
+    void clear(bool writeData = false) { (void)writeData; }
+
+private:
+    uint8_t _brightness = 255;
+};
+
+extern CFastLED FastLED;
+
+#endif // FASTLED_SHIM_H
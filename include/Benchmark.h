@@ -0,0 +1,36 @@
+/**
+ * @file Benchmark.h
+ * @brief On-device sweep of every pattern with and without LED output
+ *
+ * Built with -D BENCHMARK_MODE=1 (see env:benchmark in platformio.ini). At
+ * boot every PatternType is rendered for a fixed number of frames, first
+ * render-only and then presented through the output stage with every frame
+ * transmitted, and a table of render time, show time and achievable frame
+ * rate is printed. Runs on the real flash cache, RMT/I2S driver and (when
+ * the sensor task is running) I2C load on core 0, so it gives the true
+ * per-strip-length ceiling of the hardware.
+ *
+ * Afterwards a static dim frame is presented repeatedly, to check that
+ * unchanged frames are still skipped once temporal dithering has settled.
+ */
+
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <Arduino.h>
+#include <LEDPatterns.h>
+
+#include "OutputStage.h"
+
+/**
+ * @brief Run the pattern sweep and print the results
+ *
+ * Leaves the strip dark and the transition time at 0.
+ *
+ * @param patterns Patterns rendering into the output stage's render buffer
+ * @param output Output stage to transmit through
+ * @param out Where to print the table
+ */
+void runBenchmark(LEDPatternsBase& patterns, OutputStage& output, Print& out);
+
+#endif // BENCHMARK_H
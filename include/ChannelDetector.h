@@ -0,0 +1,122 @@
+/**
+ * @file ChannelDetector.h
+ * @brief Debounced detection and smoothed intensity for one sensor channel
+ *
+ * A channel (presence, motion, ...) is active on a reading when the
+ * sensor's flag is set and the raw value's magnitude exceeds MinValue. The
+ * detected state only changes after DebounceCount consecutive readings
+ * disagree with it. The debounce is a constexpr transition table indexed
+ * by state and input, so an update is one table read, not a chain of
+ * counter branches.
+ *
+ * While detected, the intensity follows the channel's IntensityMap. Small
+ * changes between readings (at most StabilityThreshold in raw value) are
+ * noise and are smoothed by an exponential moving average with weight
+ * 1 / 2^SmoothingShift. Larger changes are real movement and apply
+ * immediately, so smoothing never delays a response.
+ *
+ *     using PresenceDetector = ChannelDetector<PresenceIntensityMap, 70, 3, 10, 2>;
+ *     PresenceDetector presence;
+ *     state.presenceDetected = presence.update(status.pres_flag, value);
+ *     state.presenceIntensity = presence.getIntensity();
+ */
+
+#ifndef CHANNEL_DETECTOR_H
+#define CHANNEL_DETECTOR_H
+
+#include <stdint.h>
+
+/**
+ * @class ChannelDetector
+ * @brief Debounce state machine, stability check and smoothing for one channel
+ *
+ * @tparam Intensity IntensityMap (anything with a static lookup(int16_t))
+ * @tparam MinValue Magnitude a raw value must exceed to count as active
+ * @tparam DebounceCount Consecutive readings needed to change state (1-127)
+ * @tparam StabilityThreshold Largest raw change that is smoothed rather than applied
+ * @tparam SmoothingShift EMA weight 1 / 2^SmoothingShift (0: no smoothing)
+ */
+template <typename Intensity, uint16_t MinValue, uint8_t DebounceCount,
+          uint16_t StabilityThreshold = 0, uint8_t SmoothingShift = 0>
+class ChannelDetector {
+public:
+    static_assert(DebounceCount >= 1 && DebounceCount <= 127, "DebounceCount must be 1-127");
+    static_assert(SmoothingShift < 8, "SmoothingShift must be below 8");
+
+    /**
+     * @brief Feed one reading
+     *
+     * @param flag The sensor's detection flag for this channel
+     * @param value Raw signed value
+     * @return Debounced detected state after this reading
+     */
+    bool update(bool flag, int16_t value) {
+        int32_t magnitude = value < 0 ? -(int32_t)value : value;
+        bool active = flag && magnitude > MinValue;
+
+        bool wasDetected = isDetected();
+        _state = TRANSITIONS.next[_state][active];
+
+        if (!isDetected()) {
+            _smoothed = 0;
+        } else if (active) {
+            // Hold the last intensity while an off-debounce is in progress
+            int32_t target = (int32_t)Intensity::lookup(value) << 8;
+            int32_t change = (int32_t)value - _lastValue;
+            bool stable = change >= -(int32_t)StabilityThreshold && change <= (int32_t)StabilityThreshold;
+            if (wasDetected && stable) {
+                _smoothed += (target - (int32_t)_smoothed) >> SmoothingShift;
+            } else {
+                _smoothed = target;
+            }
+        }
+
+        _lastValue = value;
+        return isDetected();
+    }
+
+    bool isDetected() const {
+        return _state >= DebounceCount;
+    }
+
+    /**
+     * @brief Smoothed intensity (0-255, 0 while not detected)
+     */
+    uint8_t getIntensity() const {
+        return (_smoothed + 0x80) >> 8;
+    }
+
+private:
+    static constexpr uint8_t NUM_STATES = DebounceCount * 2;
+
+    /**
+     * States 0..DebounceCount-1 are "not detected" with that many active
+     * readings in a row; DebounceCount..2*DebounceCount-1 are "detected"
+     * with (state - DebounceCount) inactive readings in a row.
+     */
+    struct Transitions {
+        uint8_t next[NUM_STATES][2];   // [state][active]
+    };
+
+    static constexpr Transitions build() {
+        Transitions table = {};
+        for (uint8_t state = 0; state < NUM_STATES; state++) {
+            if (state < DebounceCount) {
+                table.next[state][0] = 0;
+                table.next[state][1] = state + 1;
+            } else {
+                table.next[state][0] = (state + 1 < NUM_STATES) ? state + 1 : 0;
+                table.next[state][1] = DebounceCount;
+            }
+        }
+        return table;
+    }
+
+    static constexpr Transitions TRANSITIONS = build();
+
+    uint8_t _state = 0;       // Debounce state, see Transitions
+    int16_t _lastValue = 0;   // Previous raw value, for the stability check
+    uint16_t _smoothed = 0;   // Smoothed intensity, 8.8 fixed point
+};
+
+#endif // CHANNEL_DETECTOR_H
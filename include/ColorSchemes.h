@@ -0,0 +1,92 @@
+/**
+ * @file ColorSchemes.h
+ * @brief Installation color schemes: which color each intensity is shown in
+ *
+ * A scheme is a short list of gradient stops over the intensity range
+ * (0 = nobody close, 255 = strongest response). The scheme is chosen with
+ * the COLOR_SCHEME build flag, e.g. -D COLOR_SCHEME=SCHEME_OCEAN, so a
+ * site can be given its own colors without touching the code.
+ *
+ * Selecting a scheme expands it once into a 256-entry table of colors,
+ * which the render loop indexes by intensity each frame, and into a
+ * palette for the field pattern that also brightens with intensity.
+ *
+ * Hues run numerically between stops. To go round through red instead
+ * (e.g. purple to orange), split the gradient at hue 255 / 0 with two
+ * neighbouring stops, as SCHEME_SUNSET does.
+ */
+
+#ifndef COLOR_SCHEMES_H
+#define COLOR_SCHEMES_H
+
+#include <Arduino.h>
+#include <FastLED.h>
+#include <Palette.h>
+
+/**
+ * @brief Built-in color schemes
+ */
+enum ColorSchemeId {
+    SCHEME_CLASSIC,        // Blue through green and yellow to red
+    SCHEME_OCEAN,          // Deep blue to cyan to pale aqua
+    SCHEME_SUNSET,         // Purple through pink and red to amber
+    SCHEME_FOREST,         // Teal through green to yellow-green
+    SCHEME_EMBER,          // Warm white to deep red
+    NUM_COLOR_SCHEMES
+};
+
+/**
+ * @brief Scheme used when COLOR_SCHEME isn't set
+ */
+#ifndef COLOR_SCHEME
+#define COLOR_SCHEME SCHEME_CLASSIC
+#endif
+
+/**
+ * @brief Short lowercase name of a scheme, for logs
+ *
+ * @param id Scheme
+ * @return Name, or "?" for an invalid scheme
+ */
+const char* colorSchemeName(ColorSchemeId id);
+
+/**
+ * @class ColorScheme
+ * @brief Expanded tables of the selected scheme
+ */
+class ColorScheme {
+public:
+    /**
+     * @brief Expand a scheme into the color table and field palette
+     *
+     * @param id Scheme to use (invalid values select SCHEME_CLASSIC)
+     * @param fieldFloor Brightness of the field palette at zero intensity
+     */
+    void select(ColorSchemeId id, uint8_t fieldFloor);
+
+    ColorSchemeId getId() const {
+        return _id;
+    }
+
+    /**
+     * @brief Color for an intensity
+     */
+    const CHSV& colorAt(uint8_t intensity) const {
+        return _colors[intensity];
+    }
+
+    /**
+     * @brief Field pattern palette: the scheme's colors, brightening from
+     *        fieldFloor at zero intensity to full at 255
+     */
+    const Palette& getFieldPalette() const {
+        return _fieldPalette;
+    }
+
+private:
+    ColorSchemeId _id = SCHEME_CLASSIC;
+    CHSV _colors[256];
+    Palette _fieldPalette;
+};
+
+#endif // COLOR_SCHEMES_H
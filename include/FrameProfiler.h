@@ -0,0 +1,213 @@
+/**
+ * @file FrameProfiler.h
+ * @brief Cycle-counter histograms for each stage of a frame
+ *
+ * Stages are timed with the CPU cycle counter (CCOUNT), which costs a
+ * single register read, and recorded into fixed-bucket histograms. Every
+ * report prints n/min/avg/p99/max per stage and per pattern, then starts a
+ * new window.
+ *
+ * Each histogram is written by one task only (the sensor stages by the
+ * sensor task on core 0, the show stage by the output task, the rest by
+ * the loop), so recording takes no locks. A report doesn't clear them
+ * either: it starts a new window, and each task clears its own histograms
+ * when it next records into them. CCOUNT is per core, so a stage must
+ * start and end on the same core.
+ *
+ * Cycles are converted to microseconds at the CPU clock the window started
+ * at, so whatever changes the clock (PowerMode) starts a new window right
+ * after; the samples of the cut-short window are dropped.
+ *
+ * Profiling is compiled in with -D FRAME_PROFILING=1. Without it every call
+ * below is an empty inline function.
+ */
+
+#ifndef FRAME_PROFILER_H
+#define FRAME_PROFILER_H
+
+#include <Arduino.h>
+#include <Pattern.h>
+
+/**
+ * @brief Per-stage timing histograms on serial (1 enables)
+ */
+#ifndef FRAME_PROFILING
+#define FRAME_PROFILING 0
+#endif
+
+/**
+ * @brief Timed stages of a frame
+ */
+enum ProfileStage {
+    PROFILE_SENSOR_I2C,      // Sensor task: reading the sample over I2C
+    PROFILE_SENSOR_PROCESS,  // Sensor task: debouncing and intensity mapping
+    PROFILE_INPUT,           // Loop: picking up the sensor snapshot and logging it
+    PROFILE_RENDER,          // Loop: LEDPatterns::render()
+    PROFILE_PRESENT,         // Loop: OutputStage::present() (wait for the wire and copy)
+    PROFILE_SHOW,            // Output task: FastLED.show()
+    PROFILE_FRAME,           // Loop: all work in one frame, excluding the sleep
+    NUM_PROFILE_STAGES       // Total number of stages
+};
+
+/**
+ * @class CycleHistogram
+ * @brief Histogram of durations in CPU cycles
+ *
+ * Buckets are logarithmic with four per octave (at most 19% wide), covering
+ * the full 32-bit range in 124 buckets. Counts saturate at 65535.
+ */
+class CycleHistogram {
+public:
+    static const uint8_t NUM_BUCKETS = 124;
+
+    CycleHistogram() {
+        reset();
+    }
+
+    /**
+     * @brief Add one sample
+     *
+     * @param cycles Duration in CPU cycles
+     */
+    void record(uint32_t cycles) {
+        uint8_t bucket = bucketIndex(cycles);
+        if (_counts[bucket] < UINT16_MAX) {
+            _counts[bucket]++;
+        }
+        _samples++;
+        _totalCycles += cycles;
+        _minCycles = min(_minCycles, cycles);
+        _maxCycles = max(_maxCycles, cycles);
+    }
+
+    /**
+     * @brief Discard all samples
+     */
+    void reset();
+
+    /**
+     * @brief Upper bound of the bucket holding the given percentile
+     *
+     * @param percent Percentile (1-100)
+     * @return Duration in CPU cycles (0 if there are no samples)
+     */
+    uint32_t percentile(uint8_t percent) const;
+
+    uint32_t getSamples() const {
+        return _samples;
+    }
+
+    uint32_t getMinCycles() const {
+        return _samples > 0 ? _minCycles : 0;
+    }
+
+    uint32_t getMaxCycles() const {
+        return _maxCycles;
+    }
+
+    uint32_t getAverageCycles() const {
+        return _samples > 0 ? (uint32_t)(_totalCycles / _samples) : 0;
+    }
+
+private:
+    static uint8_t bucketIndex(uint32_t cycles) {
+        if (cycles < 4) {
+            return cycles;
+        }
+        uint8_t e = 31 - __builtin_clz(cycles);
+        return ((e - 1) << 2) | ((cycles >> (e - 2)) & 3);
+    }
+
+    static uint32_t bucketUpperBound(uint8_t bucket);
+
+    uint16_t _counts[NUM_BUCKETS];  // Samples per bucket
+    uint32_t _samples;              // Samples in this window
+    uint64_t _totalCycles;          // Sum of all samples
+    uint32_t _minCycles;            // Shortest sample
+    uint32_t _maxCycles;            // Longest sample
+};
+
+#if FRAME_PROFILING
+
+/**
+ * @brief Current value of the CPU cycle counter
+ */
+inline uint32_t profileCycles() {
+    return ESP.getCycleCount();
+}
+
+/**
+ * @brief Record the duration of a stage
+ *
+ * @param stage Stage that was timed
+ * @param cycles Duration in CPU cycles
+ */
+void profileRecord(ProfileStage stage, uint32_t cycles);
+
+/**
+ * @brief Record the render time of a pattern
+ *
+ * @param type Pattern that was rendered
+ * @param cycles Duration in CPU cycles
+ */
+void profileRecordPattern(PatternType type, uint32_t cycles);
+
+/**
+ * @brief Drop the samples so far and start a new window (loop task only)
+ *
+ * Call right after changing the CPU clock.
+ */
+void profileStartWindow();
+
+/**
+ * @brief Print the histogram summaries and start a new window (loop task only)
+ *
+ * @param out Where to print the report
+ */
+void reportFrameProfile(Print& out);
+
+#else
+
+inline uint32_t profileCycles() {
+    return 0;
+}
+
+inline void profileRecord(ProfileStage /*stage*/, uint32_t /*cycles*/) {
+}
+
+inline void profileRecordPattern(PatternType /*type*/, uint32_t /*cycles*/) {
+}
+
+inline void profileStartWindow() {
+}
+
+inline void reportFrameProfile(Print& /*out*/) {
+}
+
+#endif // FRAME_PROFILING
+
+/**
+ * @class ProfileScope
+ * @brief Records the time from construction to destruction as one stage
+ */
+class ProfileScope {
+public:
+    explicit ProfileScope(ProfileStage stage) :
+        _stage(stage),
+        _start(profileCycles())
+    {
+    }
+
+    ~ProfileScope() {
+        profileRecord(_stage, profileCycles() - _start);
+    }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    ProfileStage _stage;   // Stage being timed
+    uint32_t _start;       // Cycle count at construction
+};
+
+#endif // FRAME_PROFILER_H
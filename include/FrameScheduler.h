@@ -0,0 +1,148 @@
+/**
+ * @file FrameScheduler.h
+ * @brief Fixed-timestep frame pacing for the render loop
+ *
+ * Frames are scheduled on absolute deadlines derived from the target FPS,
+ * so time spent rendering, on I2C or in FastLED.show() no longer adds to
+ * the frame period. Only the remaining slack is slept: a one-shot
+ * esp_timer notifies the render loop at the deadline, and until then it is
+ * blocked, so the idle task (and light sleep, when power management is
+ * enabled) can run instead of the CPU spinning.
+ *
+ * A task notification to the render loop ends the sleep early and the next
+ * frame starts right away, so another task can get a reaction without
+ * waiting out a long frame period. For lower power between frames, the
+ * sleep itself can be replaced, e.g. by light sleep (setSleepFunction()).
+ */
+
+#ifndef FRAME_SCHEDULER_H
+#define FRAME_SCHEDULER_H
+
+#include <Arduino.h>
+#include <esp_timer.h>
+
+#include <atomic>
+
+/**
+ * @class FrameScheduler
+ * @brief Paces the render loop to a target frame rate and counts overruns
+ */
+class FrameScheduler {
+public:
+    /**
+     * @brief Replacement for the sleep between frames
+     *
+     * @param us Time to the next frame deadline in microseconds
+     * @param context Pointer passed to setSleepFunction()
+     * @return false if woken early, so the next frame should start now
+     */
+    typedef bool (*SleepFunction)(uint32_t us, void* context);
+
+    /**
+     * @brief Constructor
+     *
+     * @param targetFps Target frame rate in frames per second
+     */
+    explicit FrameScheduler(uint16_t targetFps);
+
+    /**
+     * @brief Start scheduling from the current time
+     *
+     * Call from the task that calls waitForNextFrame(); the deadline timer
+     * wakes that task.
+     */
+    void begin();
+
+    /**
+     * @brief Sleep until the next frame deadline
+     *
+     * Call once at the end of every frame. If the frame overran its
+     * deadline the overrun is counted and no sleep happens; if it overran
+     * by a whole period or more the schedule is re-based on the current
+     * time rather than rendering a burst of catch-up frames. If the sleep
+     * is ended early the next frame starts immediately and the schedule
+     * continues from there.
+     *
+     * @return Scheduled start time of the next frame in microseconds
+     */
+    uint32_t waitForNextFrame();
+
+    /**
+     * @brief Change the target frame rate
+     *
+     * @param targetFps Target frame rate in frames per second
+     */
+    void setTargetFps(uint16_t targetFps);
+
+    /**
+     * @brief Sleep between frames with a function of the application's
+     *
+     * The scheduler still busy-waits whatever part of the period the
+     * function leaves.
+     *
+     * @param sleep Sleep function, or nullptr for the default scheduler sleep
+     * @param context Passed to sleep
+     */
+    void setSleepFunction(SleepFunction sleep, void* context = nullptr) {
+        _sleep = sleep;
+        _sleepContext = context;
+    }
+
+    uint16_t getTargetFps() const {
+        return _targetFps;
+    }
+
+    uint32_t getFramePeriodUs() const {
+        return _periodUs;
+    }
+
+    /**
+     * @brief Scheduled start time of the current frame in microseconds
+     */
+    uint32_t getFrameStartUs() const {
+        return _frameStartUs;
+    }
+
+    /**
+     * @brief Time the last frame spent working (excluding sleep) in microseconds
+     */
+    uint32_t getLastFrameWorkUs() const {
+        return _lastWorkUs;
+    }
+
+    uint32_t getFrameCount() const {
+        return _frameCount;
+    }
+
+    uint32_t getOverrunCount() const {
+        return _overrunCount;
+    }
+
+    /**
+     * @brief Largest overrun seen so far in microseconds
+     */
+    uint32_t getWorstOverrunUs() const {
+        return _worstOverrunUs;
+    }
+
+private:
+    bool sleepUntil(uint32_t deadlineUs);
+    bool startTimer(uint32_t us);
+    static void onDeadline(void* context);
+
+    uint16_t _targetFps;       // Target frame rate
+    uint32_t _periodUs;        // Frame period in microseconds
+    uint32_t _frameStartUs;    // Scheduled start of the current frame
+    uint32_t _deadlineUs;      // Scheduled start of the next frame
+    uint32_t _lastWorkUs;      // Work time of the last frame
+    uint32_t _frameCount;      // Frames completed
+    uint32_t _overrunCount;    // Frames that missed their deadline
+    uint32_t _worstOverrunUs;  // Largest deadline miss
+    SleepFunction _sleep;      // Application sleep between frames, nullptr for the default
+    void* _sleepContext;       // Passed to _sleep
+    esp_timer_handle_t _timer; // One-shot timer that wakes the loop at the deadline, nullptr if unavailable
+    TaskHandle_t _task;        // Task that waits for the frames (the one that called begin())
+    std::atomic<bool> _timerFired;  // The timer has notified _task since it was last started
+};
+
+#endif // FRAME_SCHEDULER_H
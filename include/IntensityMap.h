@@ -0,0 +1,234 @@
+/**
+ * @file IntensityMap.h
+ * @brief Compile-time lookup tables mapping raw sensor values to intensity
+ *
+ * Raw presence/motion values are signed 16-bit. Their magnitude is binned
+ * like a tiny floating-point number: values below 32 map to their own bin,
+ * larger values keep their top 6 significant bits (32 bins per octave).
+ * That gives 384 bins over the whole 0..32768 range, each evaluated once at
+ * compile time at its midpoint, so the hot path is a count-leading-zeros,
+ * a shift and one table read with no float math. Midpoints are within
+ * 1.6% of any value in their bin; for the log curves the result is never
+ * more than one intensity step from the float formula.
+ *
+ * The curve is a template parameter, so swapping a log mapping for a
+ * linear or gamma one costs nothing at runtime:
+ *
+ *     using PresenceIntensity = IntensityMap<LogCurve<60>>;
+ *     uint8_t intensity = PresenceIntensity::lookup(presenceValue);
+ *
+ * TunableLogIntensityMap keeps the same bins in RAM so the log scale can
+ * be changed at runtime; it starts out as a copy of the compile-time table.
+ */
+
+#ifndef INTENSITY_MAP_H
+#define INTENSITY_MAP_H
+
+#include <math.h>
+#include <stdint.h>
+
+namespace intensity_math {
+
+constexpr double LN2 = 0.69314718055994530942;
+constexpr double LN10 = 2.30258509299404568402;
+
+/**
+ * @brief Natural logarithm usable in constant expressions (x > 0)
+ */
+constexpr double ln(double x) {
+    int exponent = 0;
+    while (x >= 2.0) {
+        x /= 2.0;
+        exponent++;
+    }
+    while (x < 1.0) {
+        x *= 2.0;
+        exponent--;
+    }
+
+    // ln(x) = 2 * atanh((x - 1) / (x + 1)), converging quickly on [1, 2)
+    double y = (x - 1.0) / (x + 1.0);
+    double y2 = y * y;
+    double term = y;
+    double sum = 0.0;
+    for (int n = 1; n < 40; n += 2) {
+        sum += term / n;
+        term *= y2;
+    }
+    return 2.0 * sum + exponent * LN2;
+}
+
+/**
+ * @brief Exponential usable in constant expressions
+ */
+constexpr double exp(double x) {
+    // Reduce to |x| < 1 so the series converges fast, then square back up
+    int halvings = 0;
+    while (x > 1.0 || x < -1.0) {
+        x /= 2.0;
+        halvings++;
+    }
+
+    double term = 1.0;
+    double sum = 1.0;
+    for (int n = 1; n < 20; n++) {
+        term *= x / n;
+        sum += term;
+    }
+    while (halvings-- > 0) {
+        sum *= sum;
+    }
+    return sum;
+}
+
+constexpr double log10(double x) {
+    return ln(x) / LN10;
+}
+
+constexpr double pow(double base, double exponent) {
+    return base <= 0.0 ? 0.0 : exp(exponent * ln(base));
+}
+
+} // namespace intensity_math
+
+/**
+ * @brief Logarithmic curve: log10(x + 1) * Scale (the original mapping)
+ */
+template <uint16_t Scale>
+struct LogCurve {
+    static constexpr double apply(double x) {
+        return intensity_math::log10(x + 1.0) * Scale;
+    }
+};
+
+/**
+ * @brief Linear curve: x * Numerator / Denominator
+ */
+template <uint16_t Numerator, uint16_t Denominator>
+struct LinearCurve {
+    static constexpr double apply(double x) {
+        return x * Numerator / Denominator;
+    }
+};
+
+/**
+ * @brief Gamma curve: 255 * (x / FullScale) ^ (GammaX100 / 100)
+ */
+template <uint16_t FullScale, uint16_t GammaX100>
+struct GammaCurve {
+    static constexpr double apply(double x) {
+        return 255.0 * intensity_math::pow(x / FullScale, GammaX100 / 100.0);
+    }
+};
+
+/**
+ * @class IntensityMap
+ * @brief Maps a signed sensor value to a 0-255 intensity through a constexpr table
+ *
+ * @tparam Curve Type with a constexpr static apply(double magnitude)
+ */
+template <typename Curve>
+class IntensityMap {
+public:
+    static constexpr uint16_t TABLE_SIZE = 384;
+
+    /**
+     * @brief Map a raw sensor value to intensity (uses its magnitude)
+     *
+     * @param value Raw signed sensor value
+     * @return Intensity (0-255)
+     */
+    static uint8_t lookup(int16_t value) {
+        return TABLE.values[binIndex(magnitude(value))];
+    }
+
+    static constexpr uint16_t magnitude(int16_t value) {
+        return value < 0 ? (uint16_t)(-(int32_t)value) : (uint16_t)value;
+    }
+
+    /**
+     * @brief Bin index for a magnitude (exact below 32, 32 bins per octave above)
+     */
+    static constexpr uint16_t binIndex(uint16_t magnitude) {
+        if (magnitude < 32) {
+            return magnitude;
+        }
+        uint8_t exponent = 31 - __builtin_clz(magnitude);
+        return ((exponent - 4) << 5) | ((magnitude >> (exponent - 5)) & 0x1F);
+    }
+
+    /**
+     * @brief Value at the middle of a bin
+     */
+    static constexpr double binMidpoint(uint16_t index) {
+        if (index < 32) {
+            return index;
+        }
+        uint8_t exponent = (index >> 5) + 4;
+        uint32_t low = (uint32_t)(32 + (index & 0x1F)) << (exponent - 5);
+        uint32_t width = (uint32_t)1 << (exponent - 5);
+        return low + (width - 1) / 2.0;
+    }
+
+    /**
+     * @brief Intensity of every bin
+     */
+    struct Table {
+        uint8_t values[TABLE_SIZE];
+    };
+
+private:
+    static constexpr Table build() {
+        Table table = {};
+        for (uint16_t i = 0; i < TABLE_SIZE; i++) {
+            double v = Curve::apply(binMidpoint(i));
+            table.values[i] = v <= 0.0 ? 0 : (v >= 255.0 ? 255 : (uint8_t)v);
+        }
+        return table;
+    }
+
+public:
+    static constexpr Table TABLE = build();
+};
+
+/**
+ * @class TunableLogIntensityMap
+ * @brief IntensityMap<LogCurve<Scale>> whose Scale can be changed at runtime
+ *
+ * Static like IntensityMap, so it plugs into ChannelDetector unchanged;
+ * each Tag type has its own table. The table starts as a copy of the
+ * compile-time one for DefaultScale. setScale() recomputes it in single
+ * precision (384 log10f calls), or copies the compile-time table back for
+ * DefaultScale. Not thread safe: call it from the thread doing lookups.
+ *
+ * @tparam Tag Any type, to tell channels apart
+ * @tparam DefaultScale Scale the table has until setScale() is called
+ */
+template <typename Tag, uint16_t DefaultScale>
+class TunableLogIntensityMap {
+public:
+    using DefaultMap = IntensityMap<LogCurve<DefaultScale>>;
+
+    static uint8_t lookup(int16_t value) {
+        return _table.values[DefaultMap::binIndex(DefaultMap::magnitude(value))];
+    }
+
+    /**
+     * @brief Rebuild the table for log10(x + 1) * scale
+     */
+    static void setScale(uint16_t scale) {
+        if (scale == DefaultScale) {
+            _table = DefaultMap::TABLE;
+            return;
+        }
+        for (uint16_t i = 0; i < DefaultMap::TABLE_SIZE; i++) {
+            float v = log10f((float)DefaultMap::binMidpoint(i) + 1.0f) * scale;
+            _table.values[i] = v <= 0.0f ? 0 : (v >= 255.0f ? 255 : (uint8_t)v);
+        }
+    }
+
+private:
+    static inline typename DefaultMap::Table _table = DefaultMap::TABLE;
+};
+
+#endif // INTENSITY_MAP_H
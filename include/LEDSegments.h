@@ -0,0 +1,70 @@
+/**
+ * @file LEDSegments.h
+ * @brief Mapping of the logical LED buffer onto physical strips
+ *
+ * Patterns always render into one logical buffer of LED_COUNT LEDs. Each
+ * segment copies a range of that buffer onto its own strip on its own GPIO
+ * pin, optionally reversed (for strips wired end to end in a zig-zag).
+ * Strips are transmitted in parallel (FastLED's ESP32 I2S driver when
+ * FASTLED_ESP32_I2S is set), so a refresh takes as long as the longest
+ * strip rather than the sum of all of them.
+ *
+ * The default is a single strip on LED_PIN. For a multi-strip installation
+ * either edit LED_SEGMENT_TABLE below or set LED_SEGMENTS in platformio.ini:
+ *
+ *     -D 'LED_SEGMENTS={19,0,150,false},{18,150,150,true}'
+ *
+ * Segments may overlap (mirroring the same range onto several strips); the
+ * physical buffer is sized from the sum of the segment lengths.
+ */
+
+#ifndef LED_SEGMENTS_H
+#define LED_SEGMENTS_H
+
+#include <Arduino.h>
+
+/**
+ * @brief One physical strip fed from a range of the logical buffer
+ */
+struct LEDSegment {
+    uint8_t pin;       // GPIO pin driving the strip
+    uint16_t start;    // First logical LED shown on the strip
+    uint16_t count;    // Number of LEDs on the strip
+    bool reversed;     // Strip runs from the end of the range to the start
+};
+
+#ifndef LED_SEGMENTS
+#define LED_SEGMENTS { LED_PIN, 0, LED_COUNT, false }
+#endif
+
+constexpr LEDSegment LED_SEGMENT_TABLE[] = { LED_SEGMENTS };
+
+constexpr size_t LED_SEGMENT_COUNT = sizeof(LED_SEGMENT_TABLE) / sizeof(LED_SEGMENT_TABLE[0]);
+
+/**
+ * @brief Total number of physical LEDs across all segments
+ */
+constexpr uint32_t ledSegmentsTotal(size_t index = 0) {
+    return index == LED_SEGMENT_COUNT ? 0 : LED_SEGMENT_TABLE[index].count + ledSegmentsTotal(index + 1);
+}
+
+/**
+ * @brief Whether every segment reads from inside the logical buffer
+ */
+constexpr bool ledSegmentsInRange(size_t index = 0) {
+    return index == LED_SEGMENT_COUNT ||
+           (LED_SEGMENT_TABLE[index].count > 0 &&
+            (uint32_t)LED_SEGMENT_TABLE[index].start + LED_SEGMENT_TABLE[index].count <= LED_COUNT &&
+            ledSegmentsInRange(index + 1));
+}
+
+constexpr uint32_t LED_PHYSICAL_COUNT = ledSegmentsTotal();
+
+#if FASTLED_ESP32_I2S
+static_assert(LED_SEGMENT_COUNT <= 24, "FastLED's ESP32 I2S driver drives at most 24 strips in parallel");
+#else
+static_assert(LED_SEGMENT_COUNT <= 8, "Without FASTLED_ESP32_I2S strips are driven by RMT, which has 8 channels");
+#endif
+static_assert(ledSegmentsInRange(), "LED segment outside the logical buffer (check start/count against LED_COUNT)");
+
+#endif // LED_SEGMENTS_H
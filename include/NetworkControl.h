@@ -0,0 +1,125 @@
+/**
+ * @file NetworkControl.h
+ * @brief Remote control and frame streaming over Wi-Fi (WIFI_SSID builds)
+ *
+ * A task pinned to core 0, next to the Wi-Fi stack, joins the network and
+ * listens on two UDP ports:
+ *
+ * - NETWORK_DDP_PORT (4048) receives frames in DDP (Distributed Display
+ *   Protocol), as sent by xLights, WLED, Resolume and most show
+ *   controllers. Only the packet header is peeked at; the pixel data is
+ *   then received by lwIP straight into its place in a stream frame, so no
+ *   copy is made between the socket and the buffer the output stage reads.
+ *   Stream frames are triple-buffered (SnapshotBuffer, filled in place):
+ *   the task fills the back frame packet by packet and publishes it on the
+ *   packet with the PUSH flag, and the render loop presents the latest
+ *   complete frame in place of the patterns. A frame is never shown half
+ *   written, and neither side waits for the other.
+ *
+ * - NETWORK_CONTROL_PORT (4210) receives text commands, one "key=value"
+ *   per line, and answers each datagram with "ok" or "error <key>":
+ *
+ *       brightness=0-255        Output brightness
+ *       pattern=fire|auto       Show one pattern instead of following the sensors
+ *       hue=0-255               Hue of a forced pattern (saturation 255)
+ *       speed=0-255             Speed of a forced pattern
+ *       transition=ms           Cross-fade time between patterns
+ *       presence_threshold=N    Sensor presence threshold
+ *       motion_threshold=N      Sensor motion threshold
+ *       hysteresis=N            Sensor presence and motion hysteresis
+ *       odr=1|2|4|8|15|30       Sensor output data rate in Hz
+ *       presence_scale=N        Log-scale factor of presence intensity
+ *       motion_scale=N          Log-scale factor of motion intensity
+ *
+ *   Every accepted datagram publishes the complete settings as a snapshot,
+ *   which the render loop picks up at the start of a frame. Sensor settings
+ *   are also stored in NVS, so they survive a reboot.
+ *
+ * Streamed frames take over from the patterns while they keep arriving and
+ * the patterns resume NETWORK_STREAM_TIMEOUT_MS after the last one. A sender
+ * driving many controllers should broadcast (or multicast) PUSH to all of
+ * them at once; each shows the frame at the start of its next render frame.
+ * A stream frame replaces the whole strip, so senders must send every LED
+ * of every frame (which DDP senders do).
+ */
+
+#ifndef NETWORK_CONTROL_H
+#define NETWORK_CONTROL_H
+
+#include <Arduino.h>
+#include <FastLED.h>
+#include <LEDPatterns.h>
+
+#include "SensorTask.h"
+
+#ifndef WIFI_PASSWORD
+#define WIFI_PASSWORD ""
+#endif
+
+/**
+ * @brief UDP port for DDP frames
+ */
+#ifndef NETWORK_DDP_PORT
+#define NETWORK_DDP_PORT 4048
+#endif
+
+/**
+ * @brief UDP port for text control commands
+ */
+#ifndef NETWORK_CONTROL_PORT
+#define NETWORK_CONTROL_PORT 4210
+#endif
+
+/**
+ * @brief Patterns resume this long after the last streamed frame
+ */
+const uint32_t NETWORK_STREAM_TIMEOUT_MS = 2500;
+
+/**
+ * @brief Settings changed over the control port
+ */
+struct RemoteSettings {
+    uint32_t sequence = 0;                   // Incremented for every accepted command datagram
+    uint8_t brightness = 0;                  // Output brightness
+    PatternType pattern = NUM_PATTERNS;      // Forced pattern, NUM_PATTERNS to follow the sensors
+    uint8_t hue = 0;                         // Hue of the forced pattern
+    uint8_t speed = 10;                      // Speed of the forced pattern
+    uint16_t transitionMs = 0;               // Cross-fade time between patterns
+    SensorConfig sensor = SENSOR_CONFIG_DEFAULT;  // Sensor thresholds, rate and scales
+};
+
+/**
+ * @brief Start joining WIFI_SSID and the network task on core 0
+ *
+ * Returns immediately; the task keeps (re)connecting in the background.
+ *
+ * @param initial Settings in effect at boot, which commands then change
+ * @return true if the task was created
+ */
+bool startNetworkTask(const RemoteSettings& initial);
+
+/**
+ * @brief Read the latest settings (render loop only)
+ *
+ * @param out Receives the settings
+ * @return true if they changed since the previous call
+ */
+bool readRemoteSettings(RemoteSettings& out);
+
+/**
+ * @brief Latest complete streamed frame (render loop only)
+ *
+ * The frame stays valid and unchanged until the next call.
+ *
+ * @param fresh Set to whether the frame is new since the previous call
+ * @return LED_COUNT LEDs, or nullptr if no frame has arrived within
+ *         NETWORK_STREAM_TIMEOUT_MS
+ */
+const CRGB* acquireStreamFrame(bool& fresh);
+
+/**
+ * @brief Number of streamed frames received since boot
+ */
+uint32_t getStreamFrameCount();
+
+#endif // NETWORK_CONTROL_H
@@ -0,0 +1,248 @@
+/**
+ * @file OutputStage.h
+ * @brief Double-buffered LED output running on its own task
+ *
+ * Patterns render into the render buffer owned by the application. When a
+ * frame is presented it is copied into the front buffer that FastLED is
+ * bound to, and a dedicated output task streams the front buffer out (RMT
+ * or I2S DMA) while the render loop moves on to the next frame. present() only
+ * blocks if the previous frame is still on the wire.
+ *
+ * The render buffer is copied rather than swapped because patterns such as
+ * twinkle() and fire() build on the previous frame's contents. The copy is
+ * also where the logical buffer is split onto the physical strips described
+ * in LEDSegments.h, and where every channel is gamma corrected and scaled
+ * by the brightness: each 8-bit value goes through a compile-time 16-bit
+ * gamma table (LED_GAMMA_X100), is scaled to 8.8 fixed point and then
+ * rounded to 8 bits. With LED_TEMPORAL_DITHER the fraction dropped by the
+ * rounding is carried into the same channel's next frame, so over a few
+ * frames every LED shows its exact level and dim fades don't band. FastLED
+ * itself runs at brightness 255 with its dithering off; it transmits the
+ * front buffer as is.
+ *
+ * Frames identical to the one last transmitted are not sent again, which
+ * frees the wire and the output task for static or slowly updating
+ * patterns. Change is detected from a hash of the frame, since the
+ * front buffer no longer holds the rendered values. While dithering has a
+ * fraction to carry, an unchanged frame is transmitted again, but only for
+ * LED_DITHER_REPEAT_FRAMES frames after each change: with gamma and
+ * brightness nearly every lit pixel has a fraction, so otherwise a static
+ * or slowly changing pattern would never be skipped. The strip is still
+ * refreshed once a second so a glitched pixel doesn't stay wrong.
+ *
+ * Before the copy, a read-only pass over the render buffer computes the
+ * hash and sums the gamma-corrected channels to estimate the frame's supply
+ * current. If the frame would draw more than LED_POWER_BUDGET_MA at the
+ * configured brightness, the brightness of that frame is reduced to fit the
+ * budget.
+ */
+
+#ifndef OUTPUT_STAGE_H
+#define OUTPUT_STAGE_H
+
+#include <Arduino.h>
+#include <FastLED.h>
+
+#include "LEDSegments.h"
+
+/**
+ * @brief Supply current available to the LEDs in mA (0 disables the limiter)
+ */
+#ifndef LED_POWER_BUDGET_MA
+#define LED_POWER_BUDGET_MA 0
+#endif
+
+/**
+ * @brief Output gamma x 100 (100 sends values linearly, 220 is typical for WS2812B)
+ */
+#ifndef LED_GAMMA_X100
+#define LED_GAMMA_X100 100
+#endif
+
+/**
+ * @brief Carry each channel's rounding error into the next frame (0 disables)
+ */
+#ifndef LED_TEMPORAL_DITHER
+#define LED_TEMPORAL_DITHER 0
+#endif
+
+/**
+ * @brief Unchanged frames transmitted again to carry dithering, after each change
+ *
+ * Enough for dim fades to show three more bits of level; the frame left on
+ * the strip is then within one step of the exact level.
+ */
+const uint8_t LED_DITHER_REPEAT_FRAMES = 8;
+
+/**
+ * @class OutputStage
+ * @brief Copies frames into a front buffer and transmits them asynchronously
+ */
+class OutputStage {
+public:
+    /**
+     * @brief Constructor
+     *
+     * @param renderBuffer Buffer the patterns render into (LED_COUNT LEDs)
+     */
+    explicit OutputStage(CRGB* renderBuffer);
+
+    /**
+     * @brief Register one FastLED controller per segment and start the output task
+     *
+     * @return true if the output task was created
+     */
+    bool begin();
+
+    /**
+     * @brief Queue the current render buffer for transmission
+     *
+     * Waits for the previous frame to finish transmitting, copies each
+     * segment of the render buffer into its strip's part of the front buffer
+     * and wakes the output task. Returns as soon as transmission has started.
+     *
+     * The frame is skipped, without waiting, if it matches the frame last
+     * transmitted and no refresh is due.
+     *
+     * @param changed false if the caller knows the render buffer hasn't been
+     *        written since the last present(), which skips the comparison
+     * @return true if the frame was queued for transmission
+     */
+    bool present(bool changed = true) {
+        return present(_render, changed);
+    }
+
+    /**
+     * @brief Queue another LED_COUNT-LED frame for transmission
+     *
+     * As present(), but reads the frame from the given buffer instead of
+     * the render buffer, e.g. one received over the network. The buffer
+     * only has to stay unchanged until this returns.
+     *
+     * @param frame Frame to transmit
+     * @param changed false if frame is known to match the last one presented
+     * @return true if the frame was queued for transmission
+     */
+    bool present(const CRGB* frame, bool changed);
+
+    /**
+     * @brief Set the global brightness frames are transmitted at
+     *
+     * The power limiter may transmit individual frames dimmer than this.
+     *
+     * @param brightness Brightness (0-255)
+     */
+    void setBrightness(uint8_t brightness) {
+        _brightness = brightness;
+        _forceTransmit = true;
+    }
+
+    /**
+     * @brief Turn temporal dithering on or off (LED_TEMPORAL_DITHER builds)
+     *
+     * At low frame rates dithering shows as flicker rather than as an
+     * in-between level, so it can be turned off while the frame rate is
+     * reduced. The carried fractions are cleared while it's off.
+     *
+     * @param enabled Whether to carry rounding errors between frames
+     */
+    void setTemporalDither(bool enabled) {
+        _ditherEnabled = enabled;
+        _forceTransmit = true;
+    }
+
+    /**
+     * @brief Force the next present() to transmit
+     *
+     * Call after changing anything that affects the output other than the
+     * render buffer. (Brightness is applied by the output stage, so use
+     * setBrightness(), not FastLED.setBrightness().)
+     */
+    void invalidate() {
+        _forceTransmit = true;
+    }
+
+    /**
+     * @brief Block until the last presented frame has been transmitted
+     */
+    void waitIdle();
+
+    /**
+     * @brief Duration of the last FastLED.show() in microseconds
+     */
+    uint32_t getLastShowUs() const {
+        return _lastShowUs;
+    }
+
+    /**
+     * @brief Time the last present() spent waiting for the wire in microseconds
+     */
+    uint32_t getLastWaitUs() const {
+        return _lastWaitUs;
+    }
+
+    /**
+     * @brief Estimated supply current of the last transmitted frame in mA
+     *
+     * Estimated at the brightness the frame was actually transmitted at.
+     */
+    uint32_t getEstimatedMa() const {
+        return _estimatedMa;
+    }
+
+    /**
+     * @brief Brightness the last frame was transmitted at
+     */
+    uint8_t getAppliedBrightness() const {
+        return _appliedBrightness;
+    }
+
+    /**
+     * @brief Number of frames dimmed to stay within LED_POWER_BUDGET_MA
+     */
+    uint32_t getLimitedFrames() const {
+        return _limitedFrames;
+    }
+
+    /**
+     * @brief Number of frames skipped because they were unchanged
+     */
+    uint32_t getSkippedFrames() const {
+        return _skippedFrames;
+    }
+
+private:
+    struct FrameSums {
+        uint32_t red = 0;            // Gamma-corrected channel sums, 8.8 fixed point
+        uint32_t green = 0;
+        uint32_t blue = 0;
+    };
+
+    static void outputTask(void* parameter);
+    uint32_t analyseFrame(const CRGB* frame, FrameSums& sums) const;
+    uint8_t applyPowerLimit(const FrameSums& sums);
+    void writeFront(const CRGB* frame, uint8_t brightness);
+
+    CRGB* _render;                   // Buffer the patterns render into
+    CRGB _front[LED_PHYSICAL_COUNT]; // Buffer FastLED transmits from, strip after strip
+#if LED_TEMPORAL_DITHER
+    uint8_t _residual[LED_PHYSICAL_COUNT * 3]; // Fraction of each channel carried to the next frame
+#endif
+    bool _ditherEnabled;             // Temporal dithering turned on (setTemporalDither())
+    bool _ditherPending;             // The last frame left a fraction to carry
+    uint8_t _ditherRepeats;          // Unchanged frames transmitted since the last change
+    uint32_t _frameHash;             // Hash of the frame last transmitted
+    TaskHandle_t _task;              // Output task
+    SemaphoreHandle_t _idle;         // Given when the front buffer is free
+    volatile uint32_t _lastShowUs;   // Duration of the last show()
+    uint32_t _lastWaitUs;            // Wait time of the last present()
+    uint32_t _lastTransmitMs;        // When a frame was last queued
+    uint32_t _skippedFrames;         // Unchanged frames not transmitted
+    bool _forceTransmit;             // Transmit the next frame regardless
+    uint8_t _brightness;             // Configured brightness
+    uint8_t _appliedBrightness;      // Brightness of the last frame after limiting
+    uint32_t _estimatedMa;           // Estimated current of the last frame
+    uint32_t _limitedFrames;         // Frames dimmed by the power limiter
+};
+
+#endif // OUTPUT_STAGE_H
@@ -0,0 +1,122 @@
+/**
+ * @file PowerMode.h
+ * @brief Lower frame rate, sensor rate and CPU clock while the room is empty
+ *
+ * After POWER_IDLE_AFTER_MS without any detection the render loop drops
+ * to POWER_IDLE_FPS, the sensors to POWER_IDLE_ODR_HZ and the CPU to
+ * POWER_IDLE_CPU_MHZ, temporal dithering is turned off (at a few frames a
+ * second it would flicker), and with POWER_LIGHT_SLEEP the time between
+ * frames is spent in light sleep instead of idling at full clock.
+ *
+ * Coming back is driven by the sensor task: the first sample in which a
+ * sensor flags presence or motion restores the sensor rate on the spot and
+ * notifies the render loop, which ends its frame wait (or its current
+ * light sleep, at most one idle frame) and restores the rest. The idle
+ * frame period is shorter than the idle sample period, so everything is
+ * back at full speed within one idle sample of someone appearing.
+ */
+
+#ifndef POWER_MODE_H
+#define POWER_MODE_H
+
+#include <Arduino.h>
+
+#include "FrameScheduler.h"
+#include "OutputStage.h"
+
+/**
+ * @brief Time without detection before going idle, in ms (0 disables idle mode)
+ */
+#ifndef POWER_IDLE_AFTER_MS
+#define POWER_IDLE_AFTER_MS 0
+#endif
+
+/**
+ * @brief Render frame rate while idle
+ */
+#ifndef POWER_IDLE_FPS
+#define POWER_IDLE_FPS 10
+#endif
+
+/**
+ * @brief Sensor output data rate while idle (1, 2, 4, 8, 15 or 30 Hz)
+ */
+#ifndef POWER_IDLE_ODR_HZ
+#define POWER_IDLE_ODR_HZ 2
+#endif
+
+/**
+ * @brief CPU clock while idle in MHz (80, 160 or 240)
+ */
+#ifndef POWER_IDLE_CPU_MHZ
+#define POWER_IDLE_CPU_MHZ 80
+#endif
+
+/**
+ * @brief Light sleep between idle frames (1 enables; never with Wi-Fi,
+ *        which loses its connection in light sleep)
+ */
+#ifndef POWER_LIGHT_SLEEP
+#define POWER_LIGHT_SLEEP 0
+#endif
+
+// Below 80 MHz the APB clock drops too, which changes the LED and I2C timing
+static_assert(POWER_IDLE_CPU_MHZ == 80 || POWER_IDLE_CPU_MHZ == 160 || POWER_IDLE_CPU_MHZ == 240,
+              "POWER_IDLE_CPU_MHZ must be 80, 160 or 240");
+static_assert(POWER_IDLE_FPS > POWER_IDLE_ODR_HZ,
+              "Idle frames must be shorter than idle sensor samples to wake within one sample");
+
+/**
+ * @class PowerMode
+ * @brief Switches the render loop, sensors and CPU between active and idle
+ */
+class PowerMode {
+public:
+    /**
+     * @brief Constructor
+     *
+     * @param scheduler Render loop scheduler (its target rate is restored on wake)
+     * @param output Output stage, drained before each light sleep
+     */
+    PowerMode(FrameScheduler& scheduler, OutputStage& output);
+
+    /**
+     * @brief Start counting the idle time from now
+     */
+    void begin();
+
+    /**
+     * @brief Feed whether anything is going on this frame (render loop, once per frame)
+     *
+     * @param active Something is detected or flagged, or the LEDs are
+     *        driven from elsewhere (e.g. a network stream)
+     * @return true while idle
+     */
+    bool update(bool active);
+
+    bool isIdle() const {
+        return _idle;
+    }
+
+    /**
+     * @brief Number of times idle mode was entered
+     */
+    uint32_t getIdleCount() const {
+        return _idleCount;
+    }
+
+private:
+    void enterIdle();
+    void exitIdle();
+    static bool lightSleep(uint32_t us, void* context);
+
+    FrameScheduler& _scheduler;
+    OutputStage& _output;
+    uint16_t _activeFps;         // Frame rate to restore on wake
+    uint32_t _activeCpuMhz;      // CPU clock to restore on wake
+    uint32_t _lastActiveMs;      // When update() was last told something is going on
+    bool _idle;                  // In idle mode
+    uint32_t _idleCount;         // Times idle mode was entered
+};
+
+#endif // POWER_MODE_H
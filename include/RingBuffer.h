@@ -0,0 +1,70 @@
+/**
+ * @file RingBuffer.h
+ * @brief Lock-free single-producer/single-consumer FIFO of fixed-size records
+ *
+ * The producer only writes the head index and the consumer only writes the
+ * tail index, so neither side ever blocks or waits on the other. When the
+ * buffer is full push() fails immediately and the record is dropped, which
+ * keeps the producer's timing independent of how fast the consumer drains.
+ */
+
+#ifndef RING_BUFFER_H
+#define RING_BUFFER_H
+
+#include <stdint.h>
+#include <atomic>
+
+template <typename T, uint16_t Capacity>
+class RingBuffer {
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+    RingBuffer() :
+        _head(0),
+        _tail(0)
+    {
+    }
+
+    /**
+     * @brief Append a record (producer side only)
+     *
+     * @param value Record to append
+     * @return false if the buffer was full and the record was dropped
+     */
+    bool push(const T& value) {
+        uint16_t head = _head.load(std::memory_order_relaxed);
+        uint16_t tail = _tail.load(std::memory_order_acquire);
+        if ((uint16_t)(head - tail) >= Capacity) {
+            return false;
+        }
+        _slots[head & INDEX_MASK] = value;
+        _head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Remove the oldest record (consumer side only)
+     *
+     * @param out Receives the oldest record
+     * @return false if the buffer was empty
+     */
+    bool pop(T& out) {
+        uint16_t tail = _tail.load(std::memory_order_relaxed);
+        uint16_t head = _head.load(std::memory_order_acquire);
+        if (head == tail) {
+            return false;
+        }
+        out = _slots[tail & INDEX_MASK];
+        _tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+private:
+    static const uint16_t INDEX_MASK = Capacity - 1;
+
+    T _slots[Capacity];
+    std::atomic<uint16_t> _head;  // Next slot to write (producer)
+    std::atomic<uint16_t> _tail;  // Next slot to read (consumer)
+};
+
+#endif // RING_BUFFER_H
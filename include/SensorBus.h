@@ -0,0 +1,129 @@
+/**
+ * @file SensorBus.h
+ * @brief I2C access to one or more STHS34PF80 presence sensors
+ *
+ * The STHS34PF80 has a fixed I2C address, so every sensor needs its own bus
+ * (the ESP32 has two controllers, Wire and Wire1) or its own channel on a
+ * TCA9548A multiplexer. SensorBus keeps a port per sensor, switches the mux
+ * channel only when the next sensor is on a different one, and reads a
+ * whole sample in two transactions: FUNC_STATUS (which also clears
+ * data-ready) and one 4-byte burst of the presence and motion outputs,
+ * instead of a transaction per library getter.
+ *
+ * A sensor whose transaction fails is skipped for a back-off period that
+ * doubles with every further failure, so an unplugged sensor costs one
+ * timed-out transaction a second instead of stalling the others.
+ */
+
+#ifndef SENSOR_BUS_H
+#define SENSOR_BUS_H
+
+#include <Arduino.h>
+#include <Wire.h>
+
+/**
+ * @brief Where one sensor is connected
+ */
+struct SensorPort {
+    TwoWire* wire = nullptr;    // Bus the sensor (or its mux) is on
+    int8_t muxChannel = -1;     // TCA9548A channel, -1 if directly on the bus
+    int8_t intPin = -1;         // GPIO wired to the sensor's INT (latched DRDY), -1 if none
+};
+
+/**
+ * @brief One sample read from a sensor
+ */
+struct SensorSample {
+    bool presenceFlag = false;  // FUNC_STATUS.PRES_FLAG
+    bool motionFlag = false;    // FUNC_STATUS.MOT_FLAG
+    int16_t presenceValue = 0;  // TPRESENCE
+    int16_t motionValue = 0;    // TMOTION
+};
+
+/**
+ * @class SensorBus
+ * @brief Register access, mux switching and error back-off for every sensor
+ *
+ * Used only by the sensor task once sensors have been added (setup() uses
+ * select() while configuring each sensor through the SparkFun library).
+ */
+class SensorBus {
+public:
+    static const uint8_t MAX_SENSORS = 8;
+    static const uint8_t MUX_ADDRESS = 0x70;   // TCA9548A default address
+
+    /**
+     * @brief Route the bus to a sensor (selects its mux channel, if any)
+     *
+     * @param port Sensor to talk to
+     * @return false if the mux didn't acknowledge
+     */
+    bool select(const SensorPort& port);
+
+    /**
+     * @brief Add a configured sensor
+     *
+     * @param port Where the sensor is connected
+     * @return false if MAX_SENSORS are already added
+     */
+    bool addSensor(const SensorPort& port);
+
+    uint8_t getSensorCount() const {
+        return _count;
+    }
+
+    const SensorPort& getPort(uint8_t index) const {
+        return _sensors[index].port;
+    }
+
+    /**
+     * @brief Whether a sensor has a sample waiting
+     *
+     * Reads the INT pin if the sensor has one (free), otherwise the STATUS
+     * register (one single-byte transaction). Always false while the
+     * sensor is backing off after an error.
+     *
+     * @param index Sensor index
+     * @param nowMs Current time in milliseconds
+     */
+    bool isReady(uint8_t index, uint32_t nowMs);
+
+    /**
+     * @brief Read a sample and clear the sensor's data-ready signal
+     *
+     * @param index Sensor index
+     * @param nowMs Current time in milliseconds
+     * @param out Receives the sample
+     * @return false if the sensor is backing off or the transaction failed
+     */
+    bool read(uint8_t index, uint32_t nowMs, SensorSample& out);
+
+    /**
+     * @brief Failed transactions since boot, over all sensors
+     */
+    uint32_t getErrorCount() const {
+        return _errorCount;
+    }
+
+private:
+    struct Sensor {
+        SensorPort port;
+        uint8_t failures = 0;       // Consecutive failed transactions
+        uint32_t retryAtMs = 0;     // No access before this time while failures > 0
+    };
+
+    bool readRegisters(const SensorPort& port, uint8_t reg, uint8_t* data, uint8_t length);
+    bool inBackoff(const Sensor& sensor, uint32_t nowMs) const;
+    void recordResult(Sensor& sensor, bool ok, uint32_t nowMs);
+
+    Sensor _sensors[MAX_SENSORS];
+    uint8_t _count = 0;
+    uint32_t _errorCount = 0;
+
+    // Mux channel currently selected (saves a transaction per sample when
+    // consecutive reads are on the same channel)
+    TwoWire* _muxWire = nullptr;
+    int8_t _muxChannel = -1;
+};
+
+#endif // SENSOR_BUS_H
@@ -0,0 +1,96 @@
+/**
+ * @file SensorConfig.h
+ * @brief Sensor settings that can be tuned at runtime and kept across reboots
+ *
+ * Thresholds, hysteresis, output data rate and the log-scale factors of
+ * the intensity curves form one SensorConfig. It is stored as a single
+ * versioned blob in NVS (the ESP32's key-value flash partition, through
+ * Preferences), read once at boot and written again only when a value
+ * actually changes, so repeated identical updates never wear the flash.
+ * A missing, old-version or invalid blob falls back to the defaults here.
+ */
+
+#ifndef SENSOR_CONFIG_H
+#define SENSOR_CONFIG_H
+
+#include <Arduino.h>
+
+/**
+ * @brief Detection thresholds written to every sensor
+ */
+struct SensorThresholds {
+    uint16_t presence;               // Presence threshold
+    uint8_t motion;                  // Motion threshold
+    uint8_t hysteresis;              // Presence and motion hysteresis
+};
+
+/**
+ * @brief Everything about the sensors that can be changed without a reflash
+ */
+struct SensorConfig {
+    SensorThresholds thresholds;     // Written to every sensor
+    uint8_t odrHz;                   // Output data rate: 1, 2, 4, 8, 15 or 30 Hz
+    uint8_t presenceScale;           // Multiplier for log-scaled presence values
+    uint8_t motionScale;             // Multiplier for log-scaled motion values
+};
+
+/**
+ * @brief Bits returned by sensorConfigChanges()
+ */
+const uint8_t SENSOR_CONFIG_THRESHOLDS = 0x01;  // Thresholds or hysteresis differ
+const uint8_t SENSOR_CONFIG_ODR = 0x02;         // Output data rate differs
+const uint8_t SENSOR_CONFIG_SCALES = 0x04;      // Intensity scale factors differ
+
+/**
+ * @brief Defaults, used until a configuration has been stored
+ */
+const uint16_t PRESENCE_THRESHOLD_DEFAULT = 100;  // Default threshold for presence detection
+const uint8_t MOTION_THRESHOLD_DEFAULT = 50;      // Default threshold for motion detection
+const uint8_t HYSTERESIS_DEFAULT = 25;            // Default hysteresis value
+const uint8_t SENSOR_ODR_HZ_DEFAULT = 30;         // Highest rate, for maximum responsiveness
+const uint8_t PRESENCE_LOG_SCALE_FACTOR = 60;     // Default multiplier for log-scaled presence values
+const uint8_t MOTION_LOG_SCALE_FACTOR = 70;       // Default multiplier for log-scaled motion values
+
+const SensorConfig SENSOR_CONFIG_DEFAULT = {
+    {PRESENCE_THRESHOLD_DEFAULT, MOTION_THRESHOLD_DEFAULT, HYSTERESIS_DEFAULT},
+    SENSOR_ODR_HZ_DEFAULT,
+    PRESENCE_LOG_SCALE_FACTOR,
+    MOTION_LOG_SCALE_FACTOR
+};
+
+/**
+ * @brief Whether the sensor supports an output data rate
+ */
+bool isSensorOdrSupported(uint8_t hz);
+
+/**
+ * @brief Whether every value is in range (presence threshold 15 bits, supported ODR)
+ */
+bool isValidSensorConfig(const SensorConfig& config);
+
+/**
+ * @brief Which parts of two configurations differ
+ *
+ * @return SENSOR_CONFIG_* bits, 0 if they're the same
+ */
+uint8_t sensorConfigChanges(const SensorConfig& a, const SensorConfig& b);
+
+/**
+ * @brief Read the stored configuration
+ *
+ * @param config Receives the stored configuration, or SENSOR_CONFIG_DEFAULT
+ * @return true if a valid configuration was stored
+ */
+bool loadSensorConfig(SensorConfig& config);
+
+/**
+ * @brief Store a configuration, if it differs from the stored one
+ *
+ * Blocks for the flash write (milliseconds) when something changed.
+ *
+ * @param config Configuration to store
+ * @return false if it had to be written and the write failed
+ */
+bool saveSensorConfig(const SensorConfig& config);
+
+#endif // SENSOR_CONFIG_H
@@ -0,0 +1,123 @@
+/**
+ * @file SensorTask.h
+ * @brief Background sensor polling for the STHS34PF80 presence sensors
+ *
+ * The sensor task runs pinned to core 0, owns all I2C traffic to the
+ * sensors, applies debouncing and intensity scaling per sensor, and
+ * publishes the combined result as a snapshot. The render loop on core 1
+ * only ever reads the latest snapshot, so I2C time (including bus errors
+ * and timeouts) never lands inside a frame.
+ *
+ * A sensor whose INT pin is wired has its DRDY output routed to that GPIO
+ * and each sample is read exactly once, triggered by the interrupt. Sensors
+ * without one are polled round-robin.
+ *
+ * The sensor configuration (SensorConfig.h) can be changed while running:
+ * the render loop requests a new one, and between samples the task writes
+ * whatever changed to every sensor, through a callback supplied by the
+ * application so the task stays the only user of the bus, rebuilds the
+ * intensity tables if a scale factor changed, and stores the result in NVS.
+ *
+ * While the room is empty the render loop can put the sensors on a lower
+ * output data rate (requestSensorIdle()). The task restores the configured
+ * rate itself on the first sample in which any sensor raises its presence
+ * or motion flag, before debouncing, and wakes the render loop, so full
+ * speed is back one idle sample after someone appears.
+ */
+
+#ifndef SENSOR_TASK_H
+#define SENSOR_TASK_H
+
+#include <Arduino.h>
+
+#include "SensorBus.h"
+#include "SensorConfig.h"
+
+/**
+ * @brief Debounced sensor state published by the sensor task
+ *
+ * With several sensors, detection is true if any sensor detects, each
+ * intensity is the highest over all sensors, and the raw values are those
+ * of the sensor with the strongest response. sensorIntensities keeps each
+ * sensor's own intensity, in SensorBus order, for spatial rendering.
+ */
+struct SensorSnapshot {
+    bool presenceDetected = false;   // Debounced presence state
+    bool motionDetected = false;     // Debounced motion state
+    uint8_t presenceIntensity = 0;   // Scaled presence intensity (0-255)
+    uint8_t motionIntensity = 0;     // Scaled motion intensity (0-255)
+    int16_t presenceValue = 0;       // Raw presence value
+    int16_t motionValue = 0;         // Raw motion value
+    uint32_t sampleTimeUs = 0;       // When the sample became available (micros)
+    uint32_t sequence = 0;           // Incremented for every published snapshot
+    uint32_t busErrors = 0;          // Failed I2C transactions since boot
+    bool flagged = false;            // A sensor raised its presence or motion flag in its latest sample (not debounced)
+    bool idle = false;               // Sensors are running at the idle rate
+    uint8_t sensorCount = 0;         // Sensors on the bus
+    uint8_t sensorIntensities[SensorBus::MAX_SENSORS] = {};  // Per sensor, max of presence and motion (0 if nothing detected)
+};
+
+/**
+ * @brief Writes a changed configuration to one sensor, called from the sensor task
+ *
+ * The bus is already routed to the sensor (SensorBus::select()).
+ *
+ * @param index Sensor index on the bus
+ * @param config New configuration
+ * @param changes SENSOR_CONFIG_THRESHOLDS and/or SENSOR_CONFIG_ODR: what to write
+ */
+typedef void (*SensorConfigWriter)(uint8_t index, const SensorConfig& config, uint8_t changes);
+
+/**
+ * @brief Start the sensor task on core 0
+ *
+ * Every sensor on the bus must already be initialized and configured
+ * (including DRDY routing for sensors with an INT pin). After this call
+ * the task is the only user of the sensors and their I2C buses.
+ *
+ * @param bus Bus with at least one sensor added
+ * @param config Configuration the sensors were set up with
+ * @param writeConfig Writes requestSensorConfig() changes to a sensor
+ *        (nullptr if the configuration is fixed)
+ * @return true if the task was created
+ */
+bool startSensorTask(SensorBus& bus, const SensorConfig& config, SensorConfigWriter writeConfig = nullptr);
+
+/**
+ * @brief Ask the sensor task to apply and store a new configuration (render loop only)
+ *
+ * Applied before the next sample is read. A request made while another is
+ * pending replaces it.
+ *
+ * @param config New configuration
+ */
+void requestSensorConfig(const SensorConfig& config);
+
+/**
+ * @brief Switch the sensors to or from an idle output data rate (render loop only)
+ *
+ * The idle rate isn't stored. When a sensor flags presence or motion the
+ * task returns to the configured rate by itself and sends a task
+ * notification to the task that made the request.
+ *
+ * @param odrHz Idle rate (isSensorOdrSupported()), or 0 for the configured rate
+ */
+void requestSensorIdle(uint8_t odrHz);
+
+/**
+ * @brief Have the sensor task check the sensors now instead of at its next timeout
+ *
+ * For after the CPU has been in light sleep, where data-ready edges and
+ * the task's timeouts don't advance.
+ */
+void pollSensorsNow();
+
+/**
+ * @brief Read the latest sensor snapshot (render loop only)
+ *
+ * @param out Receives the latest snapshot
+ * @return true if the snapshot is new since the previous call
+ */
+bool readSensorSnapshot(SensorSnapshot& out);
+
+#endif // SENSOR_TASK_H
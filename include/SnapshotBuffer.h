@@ -0,0 +1,103 @@
+/**
+ * @file SnapshotBuffer.h
+ * @brief Lock-free single-producer/single-consumer "latest value" buffer
+ *
+ * A triple buffer: the producer always owns one slot, the consumer owns
+ * another, and the third is handed back and forth through a single atomic
+ * byte. Neither side ever blocks or waits on the other, and the consumer
+ * always sees the most recently completed snapshot.
+ *
+ * Large snapshots (e.g. whole LED frames) can be filled and read in place
+ * with back()/commit() and acquire()/front() instead of being copied in
+ * and out by publish() and read().
+ */
+
+#ifndef SNAPSHOT_BUFFER_H
+#define SNAPSHOT_BUFFER_H
+
+#include <stdint.h>
+#include <atomic>
+
+template <typename T>
+class SnapshotBuffer {
+public:
+    SnapshotBuffer() :
+        _writeIndex(0),
+        _readIndex(1),
+        _middle(2)
+    {
+    }
+
+    /**
+     * @brief Publish a new snapshot (producer side only)
+     *
+     * @param value Snapshot to publish
+     */
+    void publish(const T& value) {
+        back() = value;
+        commit();
+    }
+
+    /**
+     * @brief Slot the producer fills next (producer side only)
+     *
+     * Holds an older snapshot, not the last one published.
+     */
+    T& back() {
+        return _slots[_writeIndex];
+    }
+
+    /**
+     * @brief Publish the contents of back() (producer side only)
+     */
+    void commit() {
+        uint8_t previous = _middle.exchange(_writeIndex | FRESH_FLAG, std::memory_order_acq_rel);
+        _writeIndex = previous & INDEX_MASK;
+    }
+
+    /**
+     * @brief Read the latest snapshot (consumer side only)
+     *
+     * @param out Receives the latest published snapshot
+     * @return true if the snapshot is new since the previous read
+     */
+    bool read(T& out) {
+        bool fresh = acquire();
+        out = front();
+        return fresh;
+    }
+
+    /**
+     * @brief Take the latest snapshot, if there is a new one (consumer side only)
+     *
+     * @return true if front() changed
+     */
+    bool acquire() {
+        bool fresh = (_middle.load(std::memory_order_relaxed) & FRESH_FLAG) != 0;
+        if (fresh) {
+            uint8_t previous = _middle.exchange(_readIndex, std::memory_order_acq_rel);
+            _readIndex = previous & INDEX_MASK;
+        }
+        return fresh;
+    }
+
+    /**
+     * @brief Snapshot taken by the last acquire() (consumer side only)
+     *
+     * Stays valid and unchanged until the next acquire().
+     */
+    const T& front() const {
+        return _slots[_readIndex];
+    }
+
+private:
+    static const uint8_t INDEX_MASK = 0x03;
+    static const uint8_t FRESH_FLAG = 0x04;
+
+    T _slots[3];
+    uint8_t _writeIndex;          // Slot owned by the producer
+    uint8_t _readIndex;           // Slot owned by the consumer
+    std::atomic<uint8_t> _middle; // Shared slot index plus fresh flag
+};
+
+#endif // SNAPSHOT_BUFFER_H
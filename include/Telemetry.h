@@ -0,0 +1,87 @@
+/**
+ * @file Telemetry.h
+ * @brief Compact binary telemetry over the serial port
+ *
+ * The render loop fills in a fixed-size record and pushes it into a
+ * lock-free ring buffer, which never blocks; if the buffer is full the
+ * record is dropped and counted. A low-priority task on core 0 drains the
+ * buffer, appends a CRC-16 and writes each record to Serial as a COBS
+ * frame delimited by 0x00 on both sides. Blocking on a full UART FIFO
+ * therefore only ever stalls that task, never the animation.
+ *
+ * Text written to Serial between frames (boot messages, profile reports)
+ * stays readable: tools/telemetry_decode.py decodes the frames and passes
+ * anything that isn't a valid frame through as text.
+ */
+
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include <Arduino.h>
+
+/**
+ * @brief Send sensor samples as binary records instead of text (1 enables)
+ */
+#ifndef SERIAL_TELEMETRY
+#define SERIAL_TELEMETRY 0
+#endif
+
+/**
+ * @brief Record types (first byte of every record)
+ */
+const uint8_t TELEMETRY_RECORD_SENSOR = 1;   // TelemetryRecord, one per sensor sample
+
+/**
+ * @brief Bits of TelemetryRecord::flags
+ */
+const uint8_t TELEMETRY_FLAG_PRESENCE = 0x01;       // Debounced presence detected
+const uint8_t TELEMETRY_FLAG_MOTION = 0x02;         // Debounced motion detected
+const uint8_t TELEMETRY_FLAG_POWER_LIMITED = 0x04;  // Last frame was dimmed by the power limiter
+const uint8_t TELEMETRY_FLAG_IDLE = 0x08;           // Running in idle power mode
+const uint8_t TELEMETRY_FLAG_SENSOR_IDLE = 0x10;    // Sensors sampling at the idle rate
+
+/**
+ * @brief One telemetry record, sent little-endian with no padding
+ *
+ * Keep in sync with RECORD_FORMAT in tools/telemetry_decode.py.
+ */
+struct __attribute__((packed)) TelemetryRecord {
+    uint8_t type;               // TELEMETRY_RECORD_SENSOR
+    uint8_t flags;              // TELEMETRY_FLAG_* bits
+    uint32_t sampleTimeUs;      // When the sensor sample became available (micros)
+    uint32_t sampleSequence;    // Sensor snapshot sequence number
+    int16_t presenceValue;      // Raw presence value
+    int16_t motionValue;        // Raw motion value
+    uint8_t presenceIntensity;  // Scaled presence intensity (0-255)
+    uint8_t motionIntensity;    // Scaled motion intensity (0-255)
+    uint8_t combinedIntensity;  // Intensity driving the pattern choice
+    uint8_t pattern;            // PatternType being rendered
+    uint32_t frameStartUs;      // Scheduled start of the frame that picked up the sample
+    uint16_t frameWorkUs;       // Work time of the previous frame (saturated)
+    uint16_t showUs;            // Duration of the last FastLED.show() (saturated)
+    uint16_t estimatedMa;       // Estimated current of the last transmitted frame (saturated)
+    uint8_t brightness;         // Brightness the last frame was transmitted at
+    uint32_t overrunCount;      // Frames that missed their deadline so far
+    uint16_t droppedRecords;    // Records dropped so far because the buffer was full (saturated)
+};
+
+/**
+ * @brief Start the telemetry task on core 0
+ *
+ * Serial must already be initialized.
+ *
+ * @return true if the task was created
+ */
+bool startTelemetryTask();
+
+/**
+ * @brief Queue a record for transmission without blocking
+ *
+ * droppedRecords is filled in by the telemetry task.
+ *
+ * @param record Record to send
+ * @return false if the buffer was full and the record was dropped
+ */
+bool sendTelemetry(const TelemetryRecord& record);
+
+#endif // TELEMETRY_H
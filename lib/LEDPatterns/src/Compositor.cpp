@@ -0,0 +1,102 @@
+/**
+ * @file Compositor.cpp
+ * @brief Blending rendered layers over a base frame
+ */
+
+#include "Compositor.h"
+
+namespace {
+
+const size_t CHUNK_BYTES = COMPOSITE_CHUNK_LEDS * sizeof(CRGB);
+
+/**
+ * Layer value scaled by its weight (0-256, where 256 is the layer itself)
+ */
+inline uint8_t weighted(uint8_t layer, uint16_t weight) {
+    return (layer * weight) >> 8;
+}
+
+inline uint8_t blendAdd(uint8_t below, uint8_t layer, uint16_t weight) {
+    uint16_t sum = below + weighted(layer, weight);
+    return sum > 255 ? 255 : sum;
+}
+
+inline uint8_t blendScreen(uint8_t below, uint8_t layer, uint16_t weight) {
+    return 255 - (((255 - below) * (256 - weighted(layer, weight))) >> 8);
+}
+
+inline uint8_t blendMax(uint8_t below, uint8_t layer, uint16_t weight) {
+    uint8_t scaled = weighted(layer, weight);
+    return scaled > below ? scaled : below;
+}
+
+inline uint8_t blendAlpha(uint8_t below, uint8_t layer, uint16_t weight) {
+    return (below * (256 - weight) + layer * weight) >> 8;
+}
+
+/**
+ * Blend one layer into a chunk of the output, byte by byte
+ *
+ * The output is never a layer, and saying so lets the loop be vectorised
+ * without a runtime overlap check.
+ */
+template <uint8_t (*Blend)(uint8_t, uint8_t, uint16_t)>
+void blendBytes(uint8_t* __restrict out, const uint8_t* __restrict layer, size_t bytes, uint16_t weight) {
+    for (size_t i = 0; i < bytes; i++) {
+        out[i] = Blend(out[i], layer[i], weight);
+    }
+}
+
+inline void blendChunk(uint8_t* out, const uint8_t* layer, size_t bytes, BlendMode mode, uint16_t weight) {
+    switch (mode) {
+        case BLEND_ADD:
+            blendBytes<blendAdd>(out, layer, bytes, weight);
+            break;
+        case BLEND_SCREEN:
+            blendBytes<blendScreen>(out, layer, bytes, weight);
+            break;
+        case BLEND_MAX:
+            blendBytes<blendMax>(out, layer, bytes, weight);
+            break;
+        case BLEND_ALPHA:
+            blendBytes<blendAlpha>(out, layer, bytes, weight);
+            break;
+        default:
+            break;
+    }
+}
+
+} // namespace
+
+/**
+ * Blend layers over a base frame, one chunk of the strip at a time
+ */
+void compositeLayers(CRGB* output, const CRGB* base, const CompositeLayer* layers, uint8_t count, uint16_t numLeds) {
+    const size_t totalBytes = numLeds * sizeof(CRGB);
+    uint8_t* out = reinterpret_cast<uint8_t*>(output);
+    const uint8_t* below = reinterpret_cast<const uint8_t*>(base);
+
+    for (size_t start = 0; start < totalBytes; start += CHUNK_BYTES) {
+        size_t bytes = min(CHUNK_BYTES, totalBytes - start);
+        if (out != below) {
+            memcpy(out + start, below + start, bytes);
+        }
+
+        for (uint8_t i = 0; i < count; i++) {
+            const CompositeLayer& layer = layers[i];
+            if (layer.opacity == 0) {
+                continue;
+            }
+            // Opacity 0-255 as a weight of 0-256, so 255 applies the layer exactly
+            uint16_t weight = layer.opacity + (layer.opacity >> 7);
+            const uint8_t* pixels = reinterpret_cast<const uint8_t*>(layer.leds) + start;
+
+            // Full chunks have a constant length, so their loops need no remainder handling
+            if (bytes == CHUNK_BYTES) {
+                blendChunk(out + start, pixels, CHUNK_BYTES, layer.mode, weight);
+            } else {
+                blendChunk(out + start, pixels, bytes, layer.mode, weight);
+            }
+        }
+    }
+}
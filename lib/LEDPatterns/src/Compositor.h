@@ -0,0 +1,66 @@
+/**
+ * @file Compositor.h
+ * @brief Blending rendered layers over a base frame
+ *
+ * compositeLayers() combines a base frame and any number of layer frames
+ * into an output frame in one pass: the strip is walked in chunks of
+ * COMPOSITE_CHUNK_LEDS, and each chunk is copied from the base and then has
+ * every layer blended into it while it is still in cache. The base and
+ * each layer are read once and the output is written once, however many
+ * layers there are, and the cost grows linearly with the number of layers.
+ *
+ * The blend loops run over packed RGB bytes (a CRGB array is r, g, b, r,
+ * g, b, ...) and treat all three channels alike, so each one is a
+ * branch-free loop over plain bytes that compilers can unroll or
+ * vectorise.
+ */
+
+#ifndef COMPOSITOR_H
+#define COMPOSITOR_H
+
+#include <Arduino.h>
+#include <FastLED.h>
+
+/**
+ * @brief How a layer is combined with what is below it
+ *
+ * Each one scales the layer by its opacity first, so opacity 255 applies
+ * the layer fully and 0 leaves what is below untouched.
+ */
+enum BlendMode {
+    BLEND_ADD,             // Sum, saturating at 255 (sparkles and glows over a base)
+    BLEND_SCREEN,          // 255 - (255 - below) * (255 - layer): brightens without clipping
+    BLEND_MAX,             // Brighter of the two, per channel
+    BLEND_ALPHA,           // Cross-fade from below to the layer by opacity
+    NUM_BLEND_MODES        // Total number of blend modes
+};
+
+/**
+ * @brief One layer to blend
+ */
+struct CompositeLayer {
+    const CRGB* leds;      // Rendered layer, as long as the output
+    BlendMode mode;        // How it is combined with the layers below
+    uint8_t opacity;       // Strength of the layer (0 skips it)
+};
+
+/**
+ * @brief LEDs blended per chunk, so a chunk of the output stays in cache
+ */
+const uint16_t COMPOSITE_CHUNK_LEDS = 32;
+
+/**
+ * @brief Blend layers over a base frame
+ *
+ * Layers are applied in order, each over the result of those before it.
+ * The output may be the base itself; it must not be one of the layers.
+ *
+ * @param output Receives the composited frame
+ * @param base Bottom frame
+ * @param layers Layers to blend, bottom first
+ * @param count Number of layers
+ * @param numLeds Number of LEDs in every frame
+ */
+void compositeLayers(CRGB* output, const CRGB* base, const CompositeLayer* layers, uint8_t count, uint16_t numLeds);
+
+#endif // COMPOSITOR_H
@@ -5,174 +5,407 @@
 
 #include "LEDPatterns.h"
 
+static_assert(NUM_PATTERNS <= 16, "LEDPatternsBase::_started has one bit per pattern");
+
+/**
+ * Default clock (wraps micros(), whose return type varies between cores)
+ */
+static uint32_t defaultClock() {
+    return micros();
+}
+
 /**
- * Constructor for LEDPatterns
+ * Constructor for LEDPatternsBase
  */
-LEDPatterns::LEDPatterns(CRGB* leds, uint16_t numLeds) :
+LEDPatternsBase::LEDPatternsBase(CRGB* leds, uint16_t numLeds, Pattern* const* patterns, FieldPattern& field) :
     _leds(leds),
     _numLeds(numLeds),
-    _lastUpdate(0),
-    _step(0),
-    _heat(nullptr)
+    _currentPattern(NUM_PATTERNS),
+    _started(0),
+    _arenaMark(PatternArena::shared().mark()),
+    _clock(defaultClock),
+    _timeUs(0),
+    _now(0),
+    _outgoingBuffer(nullptr),
+    _incomingBuffer(nullptr),
+    _outgoingPattern(NUM_PATTERNS),
+    _transitionStart(0),
+    _transitionTime(0),
+    _transitioning(false),
+    _layerCount(0),
+    _baseBuffer(nullptr),
+    _compositing(false),
+    _layersChanged(false),
+    _patterns(patterns),
+    _fieldPattern(field)
 {
-    // Allocate memory for fire effect if more than 0 LEDs
-    if (_numLeds > 0) {
-        _heat = new uint8_t[_numLeds];
-        // Initialize heat array
-        for (uint16_t i = 0; i < _numLeds; i++) {
-            _heat[i] = 0;
+    if (_numLeds == 0) {
+        return;
+    }
+
+    // Take all scratch memory once, up front. If the arena is too small the
+    // affected pattern renders nothing (or the fade is skipped) rather than
+    // failing at runtime.
+    PatternArena& arena = PatternArena::shared();
+
+    for (uint8_t i = 0; i < NUM_PATTERNS; i++) {
+        size_t bytes = _patterns[i]->scratchSize(_numLeds);
+        if (bytes > 0) {
+            _patterns[i]->attachScratch(arena.allocate(bytes));
         }
     }
+
+    _outgoingBuffer = reinterpret_cast<CRGB*>(arena.allocate(_numLeds * sizeof(CRGB)));
+    _incomingBuffer = reinterpret_cast<CRGB*>(arena.allocate(_numLeds * sizeof(CRGB)));
+    if (_incomingBuffer == nullptr) {
+        _outgoingBuffer = nullptr;
+    }
+}
+
+/**
+ * Destructor for LEDPatternsBase
+ */
+LEDPatternsBase::~LEDPatternsBase() {
+    PatternArena::shared().release(_arenaMark);
+}
+
+/**
+ * Render one frame of a pattern, cross-fading if the pattern changed
+ */
+bool LEDPatternsBase::render(PatternType type, const PatternParams& params, uint32_t frameUs) {
+    if (type >= NUM_PATTERNS || _numLeds == 0) {
+        return false;
+    }
+
+    // Advance by the wrap-safe difference from the previous timestamp, whose
+    // low 32 bits are those of _timeUs
+    _timeUs += (uint32_t)(frameUs - (uint32_t)_timeUs);
+    _now = _timeUs / 1000;
+
+    // While layers are shown the base pattern renders into its own buffer
+    // and only the composite goes to the LED array, so patterns that build
+    // on their previous frame still see their own. Showing or hiding the
+    // last layer moves the base frame across.
+    bool compositing = layersShown();
+    if (compositing != _compositing) {
+        if (compositing) {
+            memcpy(_baseBuffer, _leds, _numLeds * sizeof(CRGB));
+        } else {
+            memcpy(_leds, _baseBuffer, _numLeds * sizeof(CRGB));
+        }
+        _compositing = compositing;
+        _layersChanged = true;
+    }
+    CRGB* base = compositing ? _baseBuffer : _leds;
+
+    bool changed = true;
+
+    if (type != _currentPattern && _currentPattern < NUM_PATTERNS &&
+        _transitionTime > 0 && _outgoingBuffer != nullptr) {
+        startTransition(type, _now, base);
+    }
+
+    if (_transitioning) {
+        uint32_t elapsed = _now - _transitionStart;
+        if (elapsed >= _transitionTime) {
+            // Fade complete: carry on from the incoming pattern's own frame
+            _transitioning = false;
+            memcpy(base, _incomingBuffer, _numLeds * sizeof(CRGB));
+            renderPattern(type, params, base);
+        } else {
+            if (_outgoingPattern < NUM_PATTERNS) {
+                renderPattern(_outgoingPattern, _outgoingParams, _outgoingBuffer);
+            }
+            renderPattern(type, params, _incomingBuffer);
+
+            uint8_t amount = (elapsed * 255) / _transitionTime;
+            blend(_outgoingBuffer, _incomingBuffer, base, _numLeds, amount);
+        }
+    } else {
+        changed = renderPattern(type, params, base);
+    }
+
+    if (compositing) {
+        // Every layer renders, even when an earlier one already changed
+        bool layersChanged = renderLayers();
+        changed = changed || layersChanged || _layersChanged;
+        if (changed) {
+            CompositeLayer shown[LEDPATTERNS_MAX_LAYERS > 0 ? LEDPATTERNS_MAX_LAYERS : 1];
+            uint8_t count = 0;
+            for (uint8_t i = 0; i < _layerCount; i++) {
+                if (_layers[i].opacity > 0) {
+                    shown[count++] = { _layers[i].leds, _layers[i].mode, _layers[i].opacity };
+                }
+            }
+            compositeLayers(_leds, _baseBuffer, shown, count, _numLeds);
+        }
+    } else {
+        changed = changed || _layersChanged;
+    }
+    _layersChanged = false;
+
+    _currentPattern = type;
+    _currentParams = params;
+    return changed;
+}
+
+/**
+ * Begin a cross-fade from the current pattern to a new one
+ */
+void LEDPatternsBase::startTransition(PatternType type, uint32_t now, const CRGB* shown) {
+    if (_transitioning && type == _outgoingPattern) {
+        // Switching back mid-fade: swap roles and run the fade in reverse
+        // from the current mix, so there is no visible jump
+        CRGB* buffer = _outgoingBuffer;
+        _outgoingBuffer = _incomingBuffer;
+        _incomingBuffer = buffer;
+
+        _outgoingPattern = _currentPattern;
+        _outgoingParams = _currentParams;
+
+        uint32_t elapsed = min(now - _transitionStart, (uint32_t)_transitionTime);
+        _transitionStart = now - (_transitionTime - elapsed);
+        return;
+    }
+
+    // Fade out from what is on the strip now. A fade that is interrupted by
+    // a third pattern freezes the current mix rather than animating it.
+    _outgoingPattern = _transitioning ? NUM_PATTERNS : _currentPattern;
+    _outgoingParams = _currentParams;
+    memcpy(_outgoingBuffer, shown, _numLeds * sizeof(CRGB));
+
+    // Patterns that build on their previous frame start from the same image
+    memcpy(_incomingBuffer, shown, _numLeds * sizeof(CRGB));
+
+    _transitionStart = now;
+    _transitioning = true;
+}
+
+/**
+ * Render one frame of a pattern into a buffer through the dispatch table
+ */
+bool LEDPatternsBase::renderPattern(PatternType type, const PatternParams& params, CRGB* leds) {
+    PatternFrame frame = { leds, _numLeds, _timeUs, _now, &_random };
+    Pattern* pattern = _patterns[type];
+
+    // Initialise each pattern once; its state then survives pattern switches
+    uint16_t bit = 1u << type;
+    if ((_started & bit) == 0) {
+        pattern->begin(frame);
+        _started |= bit;
+    }
+
+    return pattern->render(frame, params);
+}
+
+/**
+ * Render every shown layer into its buffer, to the current frame time
+ */
+bool LEDPatternsBase::renderLayers() {
+    bool changed = false;
+    for (uint8_t i = 0; i < _layerCount; i++) {
+        Layer& layer = _layers[i];
+        if (layer.opacity == 0) {
+            continue;
+        }
+
+        PatternFrame frame = { layer.leds, _numLeds, _timeUs, _now, &_random };
+        if (!layer.started) {
+            layer.pattern->begin(frame);
+            layer.started = true;
+        }
+        if (layer.pattern->render(frame, layer.params)) {
+            changed = true;
+        }
+    }
+    return changed;
+}
+
+bool LEDPatternsBase::layersShown() const {
+    for (uint8_t i = 0; i < _layerCount; i++) {
+        if (_layers[i].opacity > 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Add a layer, taking its buffer and its pattern's scratch memory from the arena
+ */
+int8_t LEDPatternsBase::addLayer(Pattern& pattern) {
+    if (_layerCount >= LEDPATTERNS_MAX_LAYERS || _numLeds == 0) {
+        return -1;
+    }
+
+    PatternArena& arena = PatternArena::shared();
+    const size_t bytes = _numLeds * sizeof(CRGB);
+
+    // The base buffer is only needed once there is something to composite
+    if (_baseBuffer == nullptr) {
+        _baseBuffer = reinterpret_cast<CRGB*>(arena.allocate(bytes));
+        if (_baseBuffer == nullptr) {
+            return -1;
+        }
+    }
+
+    CRGB* leds = reinterpret_cast<CRGB*>(arena.allocate(bytes));
+    if (leds == nullptr) {
+        return -1;
+    }
+    // Arena memory may hold an earlier instance's frames
+    memset(reinterpret_cast<uint8_t*>(leds), 0, bytes);
+
+    size_t scratch = pattern.scratchSize(_numLeds);
+    if (scratch > 0) {
+        pattern.attachScratch(arena.allocate(scratch));
+    }
+
+    Layer& layer = _layers[_layerCount];
+    layer.pattern = &pattern;
+    layer.leds = leds;
+    layer.params = PatternParams();
+    layer.mode = BLEND_ADD;
+    layer.opacity = 0;
+    layer.started = false;
+    return _layerCount++;
+}
+
+/**
+ * Show a layer with new parameters
+ */
+void LEDPatternsBase::setLayer(uint8_t layer, const PatternParams& params, BlendMode mode, uint8_t opacity) {
+    if (layer >= _layerCount || mode >= NUM_BLEND_MODES) {
+        return;
+    }
+    Layer& target = _layers[layer];
+    if (target.mode != mode || target.opacity != opacity) {
+        _layersChanged = true;
+    }
+    target.params = params;
+    target.mode = mode;
+    target.opacity = opacity;
+}
+
+/**
+ * Hide a layer
+ */
+void LEDPatternsBase::hideLayer(uint8_t layer) {
+    if (layer >= _layerCount) {
+        return;
+    }
+    if (_layers[layer].opacity != 0) {
+        _layersChanged = true;
+    }
+    _layers[layer].opacity = 0;
 }
 
 /**
  * Apply a solid color pattern (RGB)
  */
-void LEDPatterns::solid(CRGB color) {
-    fill_solid(_leds, _numLeds, color);
+void LEDPatternsBase::solid(CRGB color) {
+    PatternParams params;
+    params.rgbColor = color;
+    params.useRgb = true;
+    render(PATTERN_SOLID, params);
 }
 
 /**
  * Apply a solid color pattern (HSV)
  */
-void LEDPatterns::solid(CHSV color) {
-    fill_solid(_leds, _numLeds, color);
+void LEDPatternsBase::solid(CHSV color) {
+    PatternParams params;
+    params.color = color;
+    render(PATTERN_SOLID, params);
 }
 
 /**
  * Apply a breathing effect
  */
-void LEDPatterns::breathing(CHSV color, uint8_t speed) {
-    // Calculate brightness based on time
-    uint8_t brightness = beatsin8(speed, 0, 255);
-    
-    // Apply brightness to the color
-    CHSV adjustedColor = CHSV(color.h, color.s, brightness);
-    
-    // Fill all LEDs with the adjusted color
-    fill_solid(_leds, _numLeds, adjustedColor);
+void LEDPatternsBase::breathing(CHSV color, uint8_t speed) {
+    PatternParams params;
+    params.color = color;
+    params.speed = speed;
+    render(PATTERN_BREATHING, params);
 }
 
 /**
  * Apply a gradient between two colors
  */
-void LEDPatterns::gradient(CHSV startColor, CHSV endColor) {
-    fill_gradient_HSV(_leds, 0, startColor, _numLeds - 1, endColor, SHORTEST_HUES);
+void LEDPatternsBase::gradient(CHSV startColor, CHSV endColor) {
+    PatternParams params;
+    params.color = startColor;
+    params.secondaryColor = endColor;
+    render(PATTERN_GRADIENT, params);
 }
 
 /**
  * Apply a rainbow effect
  */
-void LEDPatterns::rainbow(uint8_t speed) {
-    // Get current time for animation
-    uint32_t ms = millis();
-    
-    // Only update if enough time has passed
-    if (ms - _lastUpdate >= 20) {
-        _lastUpdate = ms;
-        
-        // Increment step based on speed
-        _step += speed;
-        
-        // Fill the LEDs with a gradient from current step
-        fill_rainbow(_leds, _numLeds, _step, 255 / _numLeds);
-    }
+void LEDPatternsBase::rainbow(uint8_t speed) {
+    PatternParams params;
+    params.speed = speed;
+    render(PATTERN_RAINBOW, params);
 }
 
 /**
  * Apply a chase effect
  */
-void LEDPatterns::chase(CHSV color, CHSV bgColor, uint8_t size, uint8_t speed) {
-    // Start by filling with background color
-    fill_solid(_leds, _numLeds, bgColor);
-    
-    // Get current time for animation
-    uint32_t ms = millis();
-    
-    // Update step based on time and speed
-    uint16_t step = (ms / (256 - speed)) % _numLeds;
-    
-    // Draw chase dots
-    for (uint8_t i = 0; i < size; i++) {
-        uint16_t pos = (step + i) % _numLeds;
-        _leds[pos] = color;
-    }
+void LEDPatternsBase::chase(CHSV color, CHSV bgColor, uint8_t size, uint8_t speed, uint8_t count) {
+    PatternParams params;
+    params.color = color;
+    params.secondaryColor = bgColor;
+    params.size = size;
+    params.speed = speed;
+    params.count = count;
+    render(PATTERN_CHASE, params);
 }
 
 /**
  * Apply a pulse effect
  */
-void LEDPatterns::pulse(CHSV color, uint8_t speed) {
-    // Get current time
-    uint32_t ms = millis();
-    
-    // Create a pulse using a sine wave
-    uint8_t brightness = beatsin8(speed, 0, 255, ms, 0);
-    
-    // Propagate the pulse through the strip
-    for (uint16_t i = 0; i < _numLeds; i++) {
-        // Phase shift based on LED position to create a wave
-        uint8_t wave = beatsin8(speed, 0, 255, ms, i * 10);
-        
-        // Use phase-shifted brightness for this LED
-        _leds[i] = CHSV(color.h, color.s, wave);
-    }
+void LEDPatternsBase::pulse(CHSV color, uint8_t speed) {
+    PatternParams params;
+    params.color = color;
+    params.speed = speed;
+    render(PATTERN_PULSE, params);
 }
 
 /**
  * Apply a fire effect
- * 
- * This is based on FastLED's Fire2012 example
  */
-void LEDPatterns::fire(uint8_t cooling, uint8_t sparking) {
-    // Make sure we have memory allocated for the heat array
-    if (_heat == nullptr) {
-        return;
-    }
-    
-    // Get current time for animation
-    uint32_t ms = millis();
-    
-    // Only update if enough time has passed
-    if (ms - _lastUpdate >= 20) {
-        _lastUpdate = ms;
-        
-        // Step 1: Cool down every cell a little
-        for (int i = 0; i < _numLeds; i++) {
-            _heat[i] = qsub8(_heat[i], random8(0, ((cooling * 10) / _numLeds) + 2));
-        }
-        
-        // Step 2: Heat from each cell drifts up and diffuses a little
-        for (int k = _numLeds - 1; k >= 2; k--) {
-            _heat[k] = (_heat[k - 1] + _heat[k - 2] + _heat[k - 2]) / 3;
-        }
-        
-        // Step 3: Randomly ignite new 'sparks' of heat near the bottom
-        if (random8() < sparking) {
-            int y = random8(7);
-            _heat[y] = qadd8(_heat[y], random8(160, 255));
-        }
-        
-        // Step 4: Map from heat cells to LED colors
-        for (int j = 0; j < _numLeds; j++) {
-            // Scale heat value into a spectrum from black to white
-            CRGB color = HeatColor(_heat[j]);
-            _leds[j] = color;
-        }
-    }
+void LEDPatternsBase::fire(uint8_t cooling, uint8_t sparking, uint8_t sparkZone) {
+    PatternParams params;
+    params.cooling = cooling;
+    params.sparking = sparking;
+    params.sparkZone = sparkZone;
+    render(PATTERN_FIRE, params);
 }
 
 /**
  * Apply a twinkle effect
  */
-void LEDPatterns::twinkle(CHSV color, uint8_t chance) {
-    // Dim all LEDs slightly
-    fadeToBlackBy(_leds, _numLeds, 10);
-    
-    // Randomly add bright pixels
-    for (uint16_t i = 0; i < _numLeds; i++) {
-        if (random8() < chance) {
-            _leds[i] = CHSV(color.h, color.s, 255);
-        }
-    }
-} 
\ No newline at end of file
+void LEDPatternsBase::twinkle(CHSV color, uint8_t chance) {
+    PatternParams params;
+    params.color = color;
+    params.chance = chance;
+    render(PATTERN_TWINKLE, params);
+}
+
+/**
+ * Apply an intensity field
+ */
+void LEDPatternsBase::field(const uint8_t* levels, CHSV lowColor, CHSV highColor) {
+    PatternParams params;
+    params.levels = levels;
+    params.color = lowColor;
+    params.secondaryColor = highColor;
+    render(PATTERN_FIELD, params);
+}
+
+void LEDPatternsBase::field(const uint8_t* levels, const Palette& palette) {
+    PatternParams params;
+    params.levels = levels;
+    params.palette = &palette;
+    render(PATTERN_FIELD, params);
+}
@@ -12,38 +12,173 @@
 #include <Arduino.h>
 #include <FastLED.h>
 
-/**
- * @brief LED pattern types
- */
-enum PatternType {
-    PATTERN_SOLID,         // Solid color
-    PATTERN_BREATHING,     // Breathing effect
-    PATTERN_GRADIENT,      // Gradient between two colors
-    PATTERN_RAINBOW,       // Rainbow effect
-    PATTERN_CHASE,         // Chase effect
-    PATTERN_PULSE,         // Pulse effect
-    PATTERN_FIRE,          // Fire effect
-    PATTERN_TWINKLE,       // Twinkle effect
-    NUM_PATTERNS           // Total number of patterns
-};
+#include "Compositor.h"
+#include "Pattern.h"
+#include "PatternArena.h"
+#include "Patterns.h"
+
+#include <type_traits>
 
 /**
- * @class LEDPatterns
+ * @class LEDPatternsBase
  * @brief Class for generating various LED patterns
+ *
+ * Renders through a table of one instance of every built-in pattern,
+ * indexed by PatternType. render() dispatches through the table; the named
+ * methods below are shorthands that fill in PatternParams and call
+ * render(). The pattern instances are owned by the derived class:
+ * LEDPatterns for a strip length chosen at runtime, FixedLEDPatterns<N>
+ * for one fixed at compile time.
+ *
+ * When a transition time is set, switching pattern cross-fades: for the
+ * duration of the fade the outgoing and incoming patterns each render into
+ * their own scratch buffer and are blended into the LED array. Switching
+ * back to the outgoing pattern mid-fade reverses the fade instead of
+ * jumping, which stops chatter around intensity thresholds.
+ *
+ * Up to LEDPATTERNS_MAX_LAYERS layers can be shown over the base pattern,
+ * e.g. twinkle sparkles added over a breathing base. Each layer renders its
+ * own pattern instance into its own buffer, and the base and all shown
+ * layers are combined into the LED array in one pass (compositeLayers()).
+ * A hidden layer costs nothing, and each shown one costs one render and
+ * one blend.
+ *
+ * All scratch memory (cross-fade buffers, layer buffers and per-pattern
+ * state) is taken from PatternArena::shared() in the constructor and
+ * addLayer(), and returned in the destructor, so nothing is allocated on
+ * the heap or while rendering.
+ * Instances therefore cannot be copied, and must be destroyed in reverse
+ * order of construction.
  */
-class LEDPatterns {
+class LEDPatternsBase {
 public:
+    LEDPatternsBase(const LEDPatternsBase&) = delete;
+    LEDPatternsBase& operator=(const LEDPatternsBase&) = delete;
+    
     /**
-     * @brief Constructor
+     * @brief Render one frame of a pattern
      * 
-     * @param leds Pointer to CRGB array
-     * @param numLeds Number of LEDs in the array
+     * The pattern's begin() hook runs the first time it is rendered; after
+     * that its state is kept across switches to other patterns.
+     * 
+     * @param type Pattern to render
+     * @param params Pattern parameters
+     * @return false if the LED array was left untouched this frame, so it
+     *         doesn't need to be transmitted again
+     */
+    bool render(PatternType type, const PatternParams& params) {
+        return render(type, params, _clock());
+    }
+    
+    /**
+     * @brief Render one frame of a pattern for a given frame time
+     * 
+     * Every pattern drawn for the frame, including both sides of a
+     * cross-fade, animates to this timestamp, so a frame can be rendered
+     * ahead of the time it will be shown. Timestamps are wrap-safe 32-bit
+     * micros() values and must not go backwards.
+     * 
+     * @param type Pattern to render
+     * @param params Pattern parameters
+     * @param frameUs Frame timestamp in microseconds
+     * @return false if the LED array was left untouched this frame
+     */
+    bool render(PatternType type, const PatternParams& params, uint32_t frameUs);
+    
+    /**
+     * @brief Clock the frame time is read from when render() isn't given one
+     *
+     * @return Time in microseconds
+     */
+    typedef uint32_t (*Clock)();
+    
+    /**
+     * @brief Replace the clock (micros() by default)
+     *
+     * With a fixed clock and random seed, rendering is fully reproducible.
+     * 
+     * @param clock Clock to read the frame time from
+     */
+    void setClock(Clock clock) {
+        _clock = clock;
+    }
+    
+    /**
+     * @brief Restart the random sequence used by fire and twinkle
+     * 
+     * @param seed Seed (every instance starts with PatternRandom::DEFAULT_SEED)
+     */
+    void setRandomSeed(uint16_t seed) {
+        _random.seed(seed);
+    }
+    
+    /**
+     * @brief Set the cross-fade time used when the pattern changes
+     * 
+     * @param ms Fade duration in milliseconds (0 switches immediately)
+     */
+    void setTransitionTime(uint16_t ms) {
+        _transitionTime = ms;
+    }
+    
+    /**
+     * @brief Check whether a cross-fade is in progress
+     * 
+     * @return true while fading between two patterns
+     */
+    bool isTransitioning() const {
+        return _transitioning;
+    }
+    
+    /**
+     * @brief Add a layer to composite over the base pattern
+     * 
+     * The layer's buffer and the pattern's scratch memory are taken from the
+     * arena here, so add layers at setup, right after construction. The
+     * layer starts hidden.
+     * 
+     * @param pattern Pattern the layer renders (caller-owned, used by this
+     *        layer only, and kept for the life of this instance)
+     * @return Layer index, or -1 if there are LEDPATTERNS_MAX_LAYERS layers
+     *         already or the arena is exhausted
      */
-    LEDPatterns(CRGB* leds, uint16_t numLeds);
+    int8_t addLayer(Pattern& pattern);
+    
+    /**
+     * @brief Show a layer over the base pattern from the next frame on
+     * 
+     * Shown layers are rendered to the same frame time as the base pattern
+     * and blended over it (and over any cross-fade) in the order they were
+     * added. Call it every frame to animate the layer's parameters.
+     * 
+     * @param layer Index returned by addLayer()
+     * @param params Parameters of the layer's pattern
+     * @param mode How the layer combines with what is below it
+     * @param opacity Strength of the layer (0 hides it)
+     */
+    void setLayer(uint8_t layer, const PatternParams& params, BlendMode mode, uint8_t opacity = 255);
+    
+    /**
+     * @brief Stop rendering and showing a layer (its pattern keeps its state)
+     * 
+     * @param layer Index returned by addLayer()
+     */
+    void hideLayer(uint8_t layer);
+    
+    /**
+     * @brief Get the number of layers added
+     * 
+     * @return Number of layers
+     */
+    uint8_t getLayerCount() const {
+        return _layerCount;
+    }
     
     /**
      * @brief Apply a solid color pattern
      * 
+     * An RGB color is shown exactly, without a round trip through HSV.
+     * 
      * @param color Color to use (CRGB or CHSV)
      */
     void solid(CRGB color);
@@ -79,8 +214,9 @@ public:
      * @param bgColor Background color
      * @param size Size of the chase (number of LEDs)
      * @param speed Speed of the effect (1-255)
+     * @param count Number of evenly spaced chasers
      */
-    void chase(CHSV color, CHSV bgColor, uint8_t size = 3, uint8_t speed = 10);
+    void chase(CHSV color, CHSV bgColor, uint8_t size = 3, uint8_t speed = 10, uint8_t count = 1);
     
     /**
      * @brief Apply a pulse effect
@@ -95,8 +231,9 @@ public:
      * 
      * @param cooling Rate of cooling (20-100)
      * @param sparking Rate of sparking (50-200)
+     * @param sparkZone Part of the strip where sparks ignite, in 1/256ths of its length
      */
-    void fire(uint8_t cooling = 55, uint8_t sparking = 120);
+    void fire(uint8_t cooling = 55, uint8_t sparking = 120, uint8_t sparkZone = 12);
     
     /**
      * @brief Apply a twinkle effect
@@ -106,6 +243,37 @@ public:
      */
     void twinkle(CHSV color, uint8_t chance = 10);
     
+    /**
+     * @brief Apply an intensity field from the sources set with setFieldSources()
+     * 
+     * @param levels Intensity of each source (must stay valid while shown)
+     * @param lowColor Color at zero intensity
+     * @param highColor Color at full intensity
+     */
+    void field(const uint8_t* levels, CHSV lowColor, CHSV highColor);
+    
+    /**
+     * @brief Apply an intensity field colored by a palette
+     * 
+     * @param levels Intensity of each source (must stay valid while shown)
+     * @param palette Color for every intensity (must stay valid while shown)
+     */
+    void field(const uint8_t* levels, const Palette& palette);
+    
+    /**
+     * @brief Place the field pattern's sources along the strip
+     * 
+     * Precomputes the per-LED weight table, so call it at setup or when the
+     * layout changes, not every frame.
+     * 
+     * @param positions LED index of each source
+     * @param count Number of sources (at most LEDPATTERNS_FIELD_SOURCES)
+     * @param radius Distance in LEDs over which a source fades to ~60%
+     */
+    void setFieldSources(const uint16_t* positions, uint8_t count, uint16_t radius) {
+        _fieldPattern.setSources(_numLeds, positions, count, radius);
+    }
+    
     /**
      * @brief Get the number of LEDs
      * 
@@ -115,14 +283,157 @@ public:
         return _numLeds;
     }
     
+    /**
+     * @brief Get the pattern rendered last
+     * 
+     * @return Last rendered pattern type (NUM_PATTERNS before the first frame)
+     */
+    PatternType getCurrentPattern() const {
+        return _currentPattern;
+    }
+    
+protected:
+    /**
+     * @brief Constructor
+     * 
+     * @param leds Pointer to CRGB array
+     * @param numLeds Number of LEDs in the array
+     * @param patterns One pattern per PatternType, in PatternType order
+     * @param field The PATTERN_FIELD entry of the table
+     */
+    LEDPatternsBase(CRGB* leds, uint16_t numLeds, Pattern* const* patterns, FieldPattern& field);
+    
+    /**
+     * @brief Destructor, returns the scratch memory to the arena
+     */
+    ~LEDPatternsBase();
+    
 private:
-    CRGB* _leds;           // Pointer to the LED array
-    uint16_t _numLeds;     // Number of LEDs
-    uint32_t _lastUpdate;  // Last update time for animations
-    uint8_t _step;         // Current step in animations
+    /**
+     * @brief A pattern shown over the base pattern
+     */
+    struct Layer {
+        Pattern* pattern;         // Pattern the layer renders (caller-owned)
+        CRGB* leds;               // Layer buffer (arena memory)
+        PatternParams params;     // Parameters it renders with
+        BlendMode mode;           // How it combines with what is below it
+        uint8_t opacity;          // Strength of the layer, 0 while hidden
+        bool started;             // Whether the pattern's begin() has run
+    };
+    
+    bool renderPattern(PatternType type, const PatternParams& params, CRGB* leds);
+    bool renderLayers();
+    bool layersShown() const;
+    void startTransition(PatternType type, uint32_t now, const CRGB* shown);
+    
+    CRGB* _leds;                  // Pointer to the LED array
+    uint16_t _numLeds;            // Number of LEDs
+    PatternType _currentPattern;  // Pattern rendered last
+    PatternParams _currentParams; // Parameters it was rendered with
+    uint16_t _started;            // Bit per PatternType whose begin() has run
+    size_t _arenaMark;            // Arena position before our scratch memory
+    Clock _clock;                 // Source of the frame time
+    uint64_t _timeUs;             // Current frame time, extended past micros() wrap
+    uint32_t _now;                // Current frame time in milliseconds
+    PatternRandom _random;        // Random numbers for all patterns of this instance
+    
+    // Cross-fade state
+    CRGB* _outgoingBuffer;        // Outgoing pattern renders here during a fade
+    CRGB* _incomingBuffer;        // Incoming pattern renders here during a fade
+    PatternType _outgoingPattern; // Pattern fading out (NUM_PATTERNS: frozen frame)
+    PatternParams _outgoingParams;// Its last parameters
+    uint32_t _transitionStart;    // When the fade started
+    uint16_t _transitionTime;     // Fade duration in milliseconds
+    bool _transitioning;          // Whether a fade is in progress
     
-    // Internal state for fire effect
-    uint8_t* _heat;        // Array for fire effect heat values
+    // Layer state
+    Layer _layers[LEDPATTERNS_MAX_LAYERS > 0 ? LEDPATTERNS_MAX_LAYERS : 1];
+    uint8_t _layerCount;          // Layers added
+    CRGB* _baseBuffer;            // Base pattern renders here while layers are shown
+    bool _compositing;            // Whether the last frame was composited
+    bool _layersChanged;          // A layer was shown, hidden or changed mode or opacity
+    
+    // Dispatch table indexed by PatternType (owned by the derived class)
+    Pattern* const* _patterns;
+    FieldPattern& _fieldPattern;
+};
+
+/**
+ * @brief One instance of every built-in pattern, and their dispatch table
+ *
+ * With N = 0 the patterns handle any strip length; otherwise those with a
+ * per-LED loop are compiled for exactly N LEDs.
+ */
+template <uint16_t N>
+struct PatternSet {
+    template <class P>
+    using Sized = typename std::conditional<N == 0, P, FixedPattern<P, N>>::type;
+    
+    SolidPattern _solid;
+    BreathingPattern _breathing;
+    Sized<GradientPattern> _gradient;
+    Sized<RainbowPattern> _rainbow;
+    Sized<ChasePattern> _chase;
+    Sized<PulsePattern> _pulse;
+    Sized<FirePattern> _fire;
+    Sized<TwinklePattern> _twinkle;
+    FieldPattern _field;
+    
+    // Must stay in PatternType order
+    Pattern* const _table[NUM_PATTERNS] = {
+        &_solid,        // PATTERN_SOLID
+        &_breathing,    // PATTERN_BREATHING
+        &_gradient,     // PATTERN_GRADIENT
+        &_rainbow,      // PATTERN_RAINBOW
+        &_chase,        // PATTERN_CHASE
+        &_pulse,        // PATTERN_PULSE
+        &_fire,         // PATTERN_FIRE
+        &_twinkle,      // PATTERN_TWINKLE
+        &_field         // PATTERN_FIELD
+    };
+};
+
+/**
+ * @class LEDPatterns
+ * @brief LED patterns for a strip whose length is given at runtime
+ */
+class LEDPatterns : private PatternSet<0>, public LEDPatternsBase {
+public:
+    /**
+     * @brief Constructor
+     * 
+     * @param leds Pointer to CRGB array
+     * @param numLeds Number of LEDs in the array
+     */
+    LEDPatterns(CRGB* leds, uint16_t numLeds) :
+        LEDPatternsBase(leds, numLeds, PatternSet<0>::_table, PatternSet<0>::_field)
+    {
+    }
+};
+
+/**
+ * @class FixedLEDPatterns
+ * @brief LED patterns for a strip of exactly N LEDs
+ *
+ * Renders the same frames as LEDPatterns(leds, N), but the per-LED loops
+ * are compiled with N as a constant: loop bounds are known, and divisions
+ * and modulos by the length (rainbow and gradient steps, chase
+ * wrap-around, fire cooling) are strength-reduced or folded away.
+ */
+template <uint16_t N>
+class FixedLEDPatterns : private PatternSet<N>, public LEDPatternsBase {
+public:
+    static_assert(N > 0, "FixedLEDPatterns needs at least one LED");
+    
+    /**
+     * @brief Constructor
+     * 
+     * @param leds Pointer to an array of N LEDs
+     */
+    explicit FixedLEDPatterns(CRGB* leds) :
+        LEDPatternsBase(leds, N, PatternSet<N>::_table, PatternSet<N>::_field)
+    {
+    }
 };
 
 #endif // LED_PATTERNS_H 
\ No newline at end of file
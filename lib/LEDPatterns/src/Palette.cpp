@@ -0,0 +1,71 @@
+/**
+ * @file Palette.cpp
+ * @brief Implementation of the 256-entry color tables
+ */
+
+#include "Palette.h"
+
+/**
+ * Interpolate a multi-stop gradient at one index
+ */
+CHSV Palette::interpolate(const PaletteStop* stops, uint8_t count, uint8_t index) {
+    if (index <= stops[0].index) {
+        return stops[0].color;
+    }
+
+    for (uint8_t k = 1; k < count; k++) {
+        const PaletteStop& a = stops[k - 1];
+        const PaletteStop& b = stops[k];
+        if (index > b.index) {
+            continue;
+        }
+        if (index == b.index) {
+            return b.color;
+        }
+
+        // Position within the segment, 0-254 (with a single 0-255 segment
+        // this is just the index)
+        uint8_t frac = (index - a.index) * 255 / (b.index - a.index);
+        return CHSV(lerp8by8(a.color.h, b.color.h, frac),
+                    lerp8by8(a.color.s, b.color.s, frac),
+                    lerp8by8(a.color.v, b.color.v, frac));
+    }
+
+    return stops[count - 1].color;
+}
+
+/**
+ * Build a piecewise linear gradient through the stops
+ */
+void Palette::buildGradient(const PaletteStop* stops, uint8_t count) {
+    for (uint16_t i = 0; i < 256; i++) {
+        _entries[i] = interpolate(stops, count, i);
+    }
+}
+
+/**
+ * Build a two-stop gradient
+ */
+void Palette::buildGradient(const CHSV& from, const CHSV& to) {
+    const PaletteStop stops[2] = {
+        { 0, from },
+        { 255, to }
+    };
+    buildGradient(stops, 2);
+}
+
+/**
+ * Build a gradient with FastLED's hue direction rules
+ */
+void Palette::buildHueGradient(const CHSV& from, const CHSV& to, TGradientDirectionCode direction) {
+    fill_gradient_HSV(_entries, 0, from, 255, to, direction);
+}
+
+/**
+ * Build the rainbow used by fill_rainbow()
+ */
+void Palette::buildRainbow(uint8_t sat, uint8_t val) {
+    for (uint16_t i = 0; i < 256; i++) {
+        _entries[i] = CHSV(i, sat, val);
+    }
+}
@@ -0,0 +1,86 @@
+/**
+ * @file Palette.h
+ * @brief Pre-expanded 256-entry color tables
+ *
+ * Patterns that vary color along the strip or over time compute an 8-bit
+ * palette index per LED and read the color from a Palette, instead of
+ * converting a CHSV per LED. A palette is rebuilt only when the colors it
+ * was built from change, so HSV-to-RGB conversion happens 256 times per
+ * change rather than once per LED per frame.
+ */
+
+#ifndef PALETTE_H
+#define PALETTE_H
+
+#include <Arduino.h>
+#include <FastLED.h>
+
+/**
+ * @brief One stop of a multi-stop gradient
+ */
+struct PaletteStop {
+    uint8_t index;         // Palette index of the stop (stops in increasing order)
+    CHSV color;            // Color at the stop
+};
+
+/**
+ * @class Palette
+ * @brief 256 CRGB entries indexed by an 8-bit value
+ */
+class Palette {
+public:
+    const CRGB& operator[](uint8_t index) const {
+        return _entries[index];
+    }
+
+    CRGB& operator[](uint8_t index) {
+        return _entries[index];
+    }
+
+    /**
+     * @brief Piecewise linear gradient through the stops
+     *
+     * Hue, saturation and value each run numerically from one stop to the
+     * next (so hue 160 to 0 passes through green, as map() would); add a
+     * stop to take a different route. Entries before the first stop and
+     * after the last take its color.
+     *
+     * @param stops Gradient stops in increasing index order
+     * @param count Number of stops (at least 1)
+     */
+    void buildGradient(const PaletteStop* stops, uint8_t count);
+
+    /**
+     * @brief Two-stop gradient from index 0 to 255
+     */
+    void buildGradient(const CHSV& from, const CHSV& to);
+
+    /**
+     * @brief Gradient with FastLED's hue direction rules (fill_gradient_HSV)
+     *
+     * @param from Color at index 0
+     * @param to Color at index 255
+     * @param direction Which way round the hue wheel to go
+     */
+    void buildHueGradient(const CHSV& from, const CHSV& to, TGradientDirectionCode direction);
+
+    /**
+     * @brief Entry i is CHSV(i, sat, val), as fill_rainbow() colors LEDs
+     */
+    void buildRainbow(uint8_t sat = 240, uint8_t val = 255);
+
+    /**
+     * @brief Color of a multi-stop gradient at an index, without building it
+     *
+     * @param stops Gradient stops in increasing index order
+     * @param count Number of stops (at least 1)
+     * @param index Position in the gradient
+     * @return Interpolated color, as buildGradient() would store it
+     */
+    static CHSV interpolate(const PaletteStop* stops, uint8_t count, uint8_t index);
+
+private:
+    CRGB _entries[256];
+};
+
+#endif // PALETTE_H
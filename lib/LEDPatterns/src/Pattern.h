@@ -0,0 +1,214 @@
+/**
+ * @file Pattern.h
+ * @brief Base interface for LED patterns
+ *
+ * Every pattern is its own object holding its own animation state, so
+ * switching between patterns never disturbs another pattern's timing.
+ * Patterns are rendered through LEDPatterns, which keeps one instance of
+ * each in a table indexed by PatternType.
+ *
+ * Patterns never allocate. A pattern that needs per-LED scratch memory
+ * reports its size from scratchSize(); LEDPatterns carves that much out of
+ * the shared PatternArena and hands it over through attachScratch().
+ *
+ * Patterns never read millis() or FastLED's global random generator either.
+ * Time and random numbers come in through PatternFrame, so with a fixed
+ * clock and seed a pattern renders the same frames on every run.
+ */
+
+#ifndef PATTERN_H
+#define PATTERN_H
+
+#include <Arduino.h>
+#include <FastLED.h>
+
+class Palette;
+
+/**
+ * @brief LED pattern types
+ */
+enum PatternType {
+    PATTERN_SOLID,         // Solid color
+    PATTERN_BREATHING,     // Breathing effect
+    PATTERN_GRADIENT,      // Gradient between two colors
+    PATTERN_RAINBOW,       // Rainbow effect
+    PATTERN_CHASE,         // Chase effect
+    PATTERN_PULSE,         // Pulse effect
+    PATTERN_FIRE,          // Fire effect
+    PATTERN_TWINKLE,       // Twinkle effect
+    PATTERN_FIELD,         // Intensity field from several sources
+    NUM_PATTERNS           // Total number of patterns
+};
+
+/**
+ * @brief Short lowercase name of a pattern type, for logs and reports
+ *
+ * @param type Pattern type
+ * @return Name, or "?" for an invalid type
+ */
+inline const char* patternName(PatternType type) {
+    static const char* const names[NUM_PATTERNS] = {
+        "solid",
+        "breathing",
+        "gradient",
+        "rainbow",
+        "chase",
+        "pulse",
+        "fire",
+        "twinkle",
+        "field"
+    };
+    return type < NUM_PATTERNS ? names[type] : "?";
+}
+
+/**
+ * @brief Parameters shared by all patterns
+ *
+ * Each pattern reads only the fields it needs. The defaults match the
+ * default arguments of the LEDPatterns convenience methods.
+ */
+struct PatternParams {
+    CHSV color = CHSV(0, 255, 255);         // Primary color (gradient start, field at zero intensity)
+    CHSV secondaryColor = CHSV(0, 0, 0);    // Chase background, gradient end, field at full intensity
+    CRGB rgbColor = CRGB(0, 0, 0);          // Solid: exact color, used instead of color if useRgb is set
+    bool useRgb = false;                    // Solid: fill with rgbColor
+    uint8_t speed = 10;                     // Speed of the effect (1-255)
+    uint8_t size = 3;                       // Chase size (number of LEDs)
+    uint8_t count = 1;                      // Chase: number of evenly spaced chasers
+    uint8_t cooling = 55;                   // Fire cooling rate (20-100)
+    uint8_t sparking = 120;                 // Fire sparking rate (50-200)
+    uint8_t sparkZone = 12;                 // Fire spark zone, fraction of the strip (/256)
+    uint8_t chance = 10;                    // Twinkle chance (1-100)
+    const uint8_t* levels = nullptr;        // Field: intensity per source (caller-owned, kept while in use)
+    const Palette* palette = nullptr;       // Field: color per intensity, instead of color..secondaryColor (caller-owned)
+};
+
+/**
+ * @class PatternRandom
+ * @brief Seedable random number generator with FastLED's random8/16 API
+ *
+ * Uses the same 16-bit LCG and output mixing as FastLED's lib8tion, so a
+ * pattern draws exactly the numbers it would from the global generator
+ * given the same seed, but each LEDPatterns instance has its own sequence.
+ */
+class PatternRandom {
+public:
+    explicit PatternRandom(uint16_t seed = DEFAULT_SEED) :
+        _seed(seed)
+    {
+    }
+
+    static const uint16_t DEFAULT_SEED = 1337;  // FastLED's initial seed
+
+    void seed(uint16_t seed) {
+        _seed = seed;
+    }
+
+    uint16_t random16() {
+        _seed = (_seed * 2053) + 13849;
+        return _seed;
+    }
+
+    uint16_t random16(uint16_t lim) {
+        return ((uint32_t)random16() * lim) >> 16;
+    }
+
+    uint8_t random8() {
+        uint16_t r = random16();
+        return (uint8_t)r + (uint8_t)(r >> 8);
+    }
+
+    uint8_t random8(uint8_t lim) {
+        return (random8() * lim) >> 8;
+    }
+
+    uint8_t random8(uint8_t min, uint8_t lim) {
+        return random8(lim - min) + min;
+    }
+
+private:
+    uint16_t _seed;        // LCG state
+};
+
+/**
+ * @brief Phase of a beat at a given time, as FastLED's beat8()
+ *
+ * At whole milliseconds this is exactly beat8(bpm) at that millis(); in
+ * between, the phase keeps moving instead of stepping once per millisecond.
+ *
+ * @param us Time in microseconds
+ * @param bpm Beats per minute
+ * @return Phase (0-255)
+ */
+inline uint8_t beatPhase8(uint64_t us, uint8_t bpm) {
+    // beat16 advances bpm * 280 / 256 per millisecond
+    return (us * bpm * 280 / 256000) >> 8;
+}
+
+/**
+ * @brief Target and timing for one rendered frame
+ *
+ * Every pattern rendered for a frame (both sides of a cross-fade) sees the
+ * same timestamp.
+ */
+struct PatternFrame {
+    CRGB* leds;            // Buffer to render into
+    uint16_t numLeds;      // Number of LEDs in the buffer
+    uint64_t timeUs;       // Frame time in microseconds (never wraps)
+    uint32_t now;          // Frame time in milliseconds (timeUs / 1000, wraps like millis())
+    PatternRandom* random; // Random numbers for this frame
+};
+
+/**
+ * @class Pattern
+ * @brief Interface implemented by every pattern
+ */
+class Pattern {
+public:
+    virtual ~Pattern() {}
+
+    /**
+     * @brief Scratch memory the pattern needs
+     *
+     * @param numLeds Number of LEDs the pattern will render
+     * @return Size in bytes (0 if none)
+     */
+    virtual size_t scratchSize(uint16_t /*numLeds*/) const {
+        return 0;
+    }
+
+    /**
+     * @brief Receive the pattern's scratch memory
+     *
+     * Called once, before begin(), with a block of scratchSize() bytes, or
+     * nullptr if the arena was exhausted (the pattern should then render
+     * nothing).
+     *
+     * @param scratch Scratch memory owned by LEDPatterns
+     */
+    virtual void attachScratch(uint8_t* /*scratch*/) {
+    }
+
+    /**
+     * @brief Initialise the pattern's state
+     *
+     * Called once, before the pattern is first rendered. State then
+     * persists across pattern switches.
+     *
+     * @param frame The first frame the pattern will render
+     */
+    virtual void begin(const PatternFrame& /*frame*/) {
+    }
+
+    /**
+     * @brief Render one frame
+     *
+     * @param frame Target buffer and frame time
+     * @param params Pattern parameters
+     * @return false if the buffer was left untouched (e.g. a throttled
+     *         pattern that isn't due to update yet), true otherwise
+     */
+    virtual bool render(const PatternFrame& frame, const PatternParams& params) = 0;
+};
+
+#endif // PATTERN_H
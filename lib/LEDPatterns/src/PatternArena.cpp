@@ -0,0 +1,17 @@
+/**
+ * @file PatternArena.cpp
+ * @brief Static storage for the shared pattern arena
+ */
+
+#include "PatternArena.h"
+
+// Word-aligned so allocations can use any element type
+static uint32_t arenaStorage[(LEDPATTERNS_ARENA_SIZE + 3) / 4];
+
+/**
+ * Get the shared arena
+ */
+PatternArena& PatternArena::shared() {
+    static PatternArena arena(reinterpret_cast<uint8_t*>(arenaStorage), sizeof(arenaStorage));
+    return arena;
+}
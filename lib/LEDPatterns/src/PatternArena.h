@@ -0,0 +1,153 @@
+/**
+ * @file PatternArena.h
+ * @brief Fixed, statically sized scratch memory for LED patterns
+ *
+ * All pattern scratch buffers (fire heat map, twinkle state, field weights,
+ * cross-fade buffers, layer buffers) come from one arena whose storage is a static array sized at
+ * compile time from LEDPATTERNS_MAX_LEDS. Nothing is taken from the heap,
+ * so there is no fragmentation on long-running devices, and the arena
+ * shows up in the linker's memory map as a single .bss object.
+ *
+ * Allocation is a bump pointer. Memory is given back in LIFO order by
+ * rewinding to a mark, which is what LEDPatterns does in its destructor.
+ */
+
+#ifndef PATTERN_ARENA_H
+#define PATTERN_ARENA_H
+
+#include <Arduino.h>
+#include <FastLED.h>
+
+/**
+ * @brief Largest strip the arena is sized for (defaults to LED_COUNT)
+ */
+#ifndef LEDPATTERNS_MAX_LEDS
+#ifdef LED_COUNT
+#define LEDPATTERNS_MAX_LEDS LED_COUNT
+#else
+#define LEDPATTERNS_MAX_LEDS 150
+#endif
+#endif
+
+/**
+ * @brief Most intensity sources the field pattern can be given
+ */
+#ifndef LEDPATTERNS_FIELD_SOURCES
+#define LEDPATTERNS_FIELD_SOURCES 8
+#endif
+
+/**
+ * @brief Most layers one LEDPatterns instance can composite over its base pattern
+ */
+#ifndef LEDPATTERNS_MAX_LAYERS
+#define LEDPATTERNS_MAX_LAYERS 2
+#endif
+
+/**
+ * @brief Scratch bytes one LEDPatterns instance needs per LED
+ *
+ * Fire heat (1) + twinkle brightness (1) + field weights (1 per source)
+ * + two cross-fade buffers (2 x CRGB)
+ */
+#define LEDPATTERNS_BYTES_PER_LED (1 + 1 + LEDPATTERNS_FIELD_SOURCES + 2 * sizeof(CRGB))
+
+/**
+ * @brief Scratch bytes each layer needs per LED
+ *
+ * Layer buffer (CRGB) + one byte of pattern state (fire heat or twinkle
+ * brightness; a field layer needs a larger LEDPATTERNS_ARENA_SIZE)
+ */
+#define LEDPATTERNS_LAYER_BYTES_PER_LED (sizeof(CRGB) + 1)
+
+/**
+ * @brief Scratch bytes per LED taken once any layer is added
+ *
+ * Base buffer (CRGB) + every layer
+ */
+#define LEDPATTERNS_LAYERS_BYTES_PER_LED \
+    (LEDPATTERNS_MAX_LAYERS > 0 ? sizeof(CRGB) + LEDPATTERNS_MAX_LAYERS * LEDPATTERNS_LAYER_BYTES_PER_LED : 0)
+
+/**
+ * @brief Total arena size in bytes
+ */
+#ifndef LEDPATTERNS_ARENA_SIZE
+#define LEDPATTERNS_ARENA_SIZE \
+    ((LEDPATTERNS_MAX_LEDS) * (LEDPATTERNS_BYTES_PER_LED + LEDPATTERNS_LAYERS_BYTES_PER_LED) + \
+     16 + 4 * (1 + 2 * LEDPATTERNS_MAX_LAYERS))
+#endif
+
+/**
+ * @class PatternArena
+ * @brief Bump allocator over a fixed block of memory
+ */
+class PatternArena {
+public:
+    /**
+     * @brief Constructor
+     *
+     * @param storage Backing memory
+     * @param capacity Size of the backing memory in bytes
+     */
+    PatternArena(uint8_t* storage, size_t capacity) :
+        _storage(storage),
+        _capacity(capacity),
+        _used(0)
+    {
+    }
+
+    PatternArena(const PatternArena&) = delete;
+    PatternArena& operator=(const PatternArena&) = delete;
+
+    /**
+     * @brief The shared arena backed by LEDPATTERNS_ARENA_SIZE bytes of static storage
+     */
+    static PatternArena& shared();
+
+    /**
+     * @brief Allocate a block
+     *
+     * @param bytes Size of the block
+     * @return Pointer to the block, or nullptr if the arena is exhausted
+     */
+    uint8_t* allocate(size_t bytes) {
+        size_t start = (_used + 3) & ~(size_t)3;
+        if (bytes == 0 || start + bytes > _capacity) {
+            return nullptr;
+        }
+        _used = start + bytes;
+        return _storage + start;
+    }
+
+    /**
+     * @brief Current allocation position, for a later release()
+     */
+    size_t mark() const {
+        return _used;
+    }
+
+    /**
+     * @brief Free everything allocated since a mark
+     *
+     * @param mark Value previously returned by mark()
+     */
+    void release(size_t mark) {
+        if (mark < _used) {
+            _used = mark;
+        }
+    }
+
+    size_t used() const {
+        return _used;
+    }
+
+    size_t capacity() const {
+        return _capacity;
+    }
+
+private:
+    uint8_t* _storage;     // Backing memory
+    size_t _capacity;      // Size of the backing memory
+    size_t _used;          // Bytes allocated so far
+};
+
+#endif // PATTERN_ARENA_H
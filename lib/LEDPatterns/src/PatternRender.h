@@ -0,0 +1,297 @@
+/**
+ * @file PatternRender.h
+ * @brief Per-LED render loops of the built-in patterns
+ *
+ * The loops are templates on the type of the LED count. LEDPatterns
+ * instantiates them with a plain uint16_t; FixedLEDPatterns<N> with
+ * FixedLength<N>, so loop bounds, per-LED steps and the divisions and
+ * modulos by the strip length become compile-time constants.
+ *
+ * Included at the end of Patterns.h; not meant to be included directly.
+ */
+
+#ifndef PATTERN_RENDER_H
+#define PATTERN_RENDER_H
+
+namespace pattern_detail {
+
+// x / 3 == (x * 683) >> 11 exactly for 0 <= x <= 765 (three heat values)
+const uint16_t DIV3_MULTIPLIER = 683;
+const uint8_t DIV3_SHIFT = 11;
+
+// Pulse wave phase offset between neighbouring LEDs (1/256ths of a cycle)
+const uint8_t PULSE_PHASE_STEP = 10;
+
+/**
+ * @brief HeatColor() for every heat value, computed at compile time
+ */
+struct HeatPalette {
+    uint8_t rgb[256][3];
+};
+
+constexpr HeatPalette makeHeatPalette() {
+    HeatPalette palette = {};
+    for (int t = 0; t < 256; t++) {
+        // Same steps as FastLED's HeatColor(): scale8_video(t, 191), then a
+        // 64-step ramp through red, yellow and white
+        uint8_t t192 = ((t * 191) >> 8) + (t ? 1 : 0);
+        uint8_t heatramp = (t192 & 0x3F) << 2;
+        uint8_t* rgb = palette.rgb[t];
+        if (t192 & 0x80) {
+            rgb[0] = 255;
+            rgb[1] = 255;
+            rgb[2] = heatramp;
+        } else if (t192 & 0x40) {
+            rgb[0] = 255;
+            rgb[1] = heatramp;
+            rgb[2] = 0;
+        } else {
+            rgb[0] = heatramp;
+            rgb[1] = 0;
+            rgb[2] = 0;
+        }
+    }
+    return palette;
+}
+
+inline constexpr HeatPalette HEAT_PALETTE = makeHeatPalette();
+
+inline bool sameHsv(const CHSV& a, const CHSV& b) {
+    return a.h == b.h && a.s == b.s && a.v == b.v;
+}
+
+/**
+ * @brief fill_solid() for an RGB color, as a memset when the color is grey
+ */
+template <class Length>
+void fillRgb(CRGB* leds, Length numLeds, const CRGB& color) {
+    if (color.r == color.g && color.g == color.b) {
+        memset(reinterpret_cast<uint8_t*>(leds), color.r, numLeds * sizeof(CRGB));
+        return;
+    }
+    for (uint16_t i = 0; i < numLeds; i++) {
+        leds[i] = color;
+    }
+}
+
+} // namespace pattern_detail
+
+/**
+ * Apply a gradient between two colors
+ */
+template <class Length>
+bool GradientPattern::renderFor(const PatternFrame& frame, const PatternParams& params, Length numLeds) {
+    if (!_paletteValid || !pattern_detail::sameHsv(params.color, _paletteStart) ||
+        !pattern_detail::sameHsv(params.secondaryColor, _paletteEnd)) {
+        _palette.buildHueGradient(params.color, params.secondaryColor, SHORTEST_HUES);
+        _paletteStart = params.color;
+        _paletteEnd = params.secondaryColor;
+        _paletteValid = true;
+    }
+
+    // Palette index in 8.16 fixed point, from 0 at the first LED to 255 at
+    // the last
+    const uint32_t step = numLeds > 1 ? (255UL << 16) / (numLeds - 1) : 0;
+    uint32_t index = 0;
+    for (uint16_t i = 0; i < numLeds; i++) {
+        frame.leds[i] = _palette[index >> 16];
+        index += step;
+    }
+    return true;
+}
+
+/**
+ * Apply a rainbow effect
+ */
+template <class Length>
+bool RainbowPattern::renderFor(const PatternFrame& frame, const PatternParams& params, Length numLeds) {
+    // Only update if enough time has passed
+    if (frame.now - _lastUpdate >= 20) {
+        _lastUpdate = frame.now;
+
+        // Increment step based on speed
+        _step += params.speed;
+
+        // Fill the LEDs with a gradient from current step. The hue step is
+        // 8.8 fixed point so the strip spans the same part of the wheel at
+        // any length (an 8-bit 255 / numLeds is 0 past 255 LEDs).
+        const uint16_t delta = (255u << 8) / numLeds;
+        uint16_t hue = _step << 8;
+        for (uint16_t i = 0; i < numLeds; i++) {
+            frame.leds[i] = _palette[hue >> 8];
+            hue += delta;
+        }
+        return true;
+    }
+
+    return false;
+}
+
+/**
+ * Draw one chaser covering [start, start + size) LEDs (8.8 fixed point)
+ */
+template <class Length>
+void ChasePattern::drawChaser(CRGB* leds, Length numLeds, uint32_t start, uint8_t size) const {
+    uint16_t pos = start >> 8;
+    uint8_t frac = start & 0xFF;
+
+    // The trailing LED is covered by 256 - frac, the leading one by frac,
+    // everything in between fully
+    for (uint16_t i = 0; i <= size; i++) {
+        uint16_t coverage = (i == 0) ? 256 - frac : (i == size) ? frac : 256;
+        if (coverage == 256) {
+            leds[pos] = _color;
+        } else if (coverage > 0) {
+            nblend(leds[pos], _color, coverage);
+        }
+        if (++pos == numLeds) {
+            pos = 0;
+        }
+    }
+}
+
+/**
+ * Apply a chase effect
+ */
+template <class Length>
+bool ChasePattern::renderFor(const PatternFrame& frame, const PatternParams& params, Length numLeds) {
+    updateColors(params);
+    pattern_detail::fillRgb(frame.leds, numLeds, _background);
+
+    uint8_t size = min((uint16_t)params.size, (uint16_t)numLeds);
+    if (size == 0) {
+        return true;
+    }
+
+    // Head position in 1/256ths of an LED, moving one LED every
+    // (256 - speed) ms
+    const uint32_t span = (uint32_t)numLeds << 8;
+    uint32_t head = (frame.timeUs * 256 / ((256 - params.speed) * 1000ULL)) % span;
+
+    uint8_t count = max(params.count, (uint8_t)1);
+    uint32_t spacing = span / count;
+    for (uint8_t i = 0; i < count; i++) {
+        drawChaser(frame.leds, numLeds, (head + i * spacing) % span, size);
+    }
+    return true;
+}
+
+/**
+ * Apply a pulse effect
+ */
+template <class Length>
+bool PulsePattern::renderFor(const PatternFrame& frame, const PatternParams& params, Length numLeds) {
+    if (!_rampValid || params.color.h != _rampHue || params.color.s != _rampSat) {
+        buildRamp(params.color.h, params.color.s);
+    }
+
+    // Wave phase for this frame, as beat8(params.speed) at the frame time
+    uint8_t phase = beatPhase8(frame.timeUs, params.speed);
+
+    // Propagate the pulse through the strip, shifting the phase per LED
+    for (uint16_t i = 0; i < numLeds; i++) {
+        frame.leds[i] = _ramp[phase];
+        phase += pattern_detail::PULSE_PHASE_STEP;
+    }
+    return true;
+}
+
+/**
+ * Apply a fire effect
+ *
+ * This is based on FastLED's Fire2012 example, restructured so the inner
+ * loops do no divisions and at most half a random number per cell:
+ * - the cooling limit is computed once per frame, not once per cell
+ * - one random16() supplies the cooling amounts for two cells
+ * - diffusion slides a two-cell window down the strip (one load per cell)
+ *   and divides by 3 with an exact multiply-shift
+ * - heat maps to color through HEAT_PALETTE instead of HeatColor()
+ */
+template <class Length>
+bool FirePattern::renderFor(const PatternFrame& frame, const PatternParams& params, Length numLeds) {
+    using namespace pattern_detail;
+
+    // Make sure we have memory allocated for the heat array
+    if (_heat == nullptr) {
+        return false;
+    }
+
+    // Only update if enough time has passed
+    if (frame.now - _lastUpdate >= 20) {
+        _lastUpdate = frame.now;
+
+        uint8_t* heat = _heat;
+        PatternRandom& random = *frame.random;
+
+        // Step 1: Cool down every cell a little, by random8(coolMax)
+        const uint16_t coolMax = min((params.cooling * 10) / numLeds + 2, 255);
+        uint16_t i = 0;
+        for (; i + 1 < numLeds; i += 2) {
+            uint16_t r = random.random16();
+            uint8_t r0 = r >> 8;
+            uint8_t r1 = (uint8_t)r + r0;
+            heat[i] = qsub8(heat[i], (r0 * coolMax) >> 8);
+            heat[i + 1] = qsub8(heat[i + 1], (r1 * coolMax) >> 8);
+        }
+        if (i < numLeds) {
+            heat[i] = qsub8(heat[i], random.random8(coolMax));
+        }
+
+        // Step 2: Heat from each cell drifts up and diffuses a little
+        if (numLeds >= 3) {
+            uint16_t below1 = heat[numLeds - 2];
+            uint16_t below2 = heat[numLeds - 3];
+            for (uint16_t k = numLeds - 1; k >= 2; k--) {
+                heat[k] = ((below1 + below2 + below2) * DIV3_MULTIPLIER) >> DIV3_SHIFT;
+                below1 = below2;
+                below2 = (k >= 3) ? heat[k - 3] : 0;
+            }
+        }
+
+        // Step 3: Randomly ignite new 'sparks' of heat near the bottom
+        if (random.random8() < params.sparking) {
+            uint16_t zone = max((numLeds * params.sparkZone) >> 8, 1);
+            uint16_t y = random.random16(zone);
+            heat[y] = qadd8(heat[y], random.random8(160, 255));
+        }
+
+        // Step 4: Map from heat cells to LED colors
+        CRGB* leds = frame.leds;
+        for (uint16_t j = 0; j < numLeds; j++) {
+            const uint8_t* rgb = HEAT_PALETTE.rgb[heat[j]];
+            leds[j].r = rgb[0];
+            leds[j].g = rgb[1];
+            leds[j].b = rgb[2];
+        }
+        return true;
+    }
+
+    return false;
+}
+
+/**
+ * Apply a twinkle effect
+ */
+template <class Length>
+bool TwinklePattern::renderFor(const PatternFrame& frame, const PatternParams& params, Length numLeds) {
+    if (_brightness == nullptr) {
+        return false;
+    }
+
+    CRGB base = CHSV(params.color.h, params.color.s, 255);
+
+    for (uint16_t i = 0; i < numLeds; i++) {
+        // Dim every sparkle slightly, or randomly start a new one
+        uint8_t brightness = scale8(_brightness[i], 255 - 10);
+        if (frame.random->random8() < params.chance) {
+            brightness = 255;
+        }
+        _brightness[i] = brightness;
+
+        frame.leds[i] = base;
+        frame.leds[i].nscale8(brightness);
+    }
+    return true;
+}
+
+#endif // PATTERN_RENDER_H
@@ -0,0 +1,214 @@
+/**
+ * @file Patterns.cpp
+ * @brief Implementation of the built-in LED patterns
+ */
+
+#include "Patterns.h"
+
+using pattern_detail::sameHsv;
+
+/**
+ * Apply a solid color pattern
+ */
+bool SolidPattern::render(const PatternFrame& frame, const PatternParams& params) {
+    if (params.useRgb) {
+        fill_solid(frame.leds, frame.numLeds, params.rgbColor);
+    } else {
+        fill_solid(frame.leds, frame.numLeds, params.color);
+    }
+    return true;
+}
+
+/**
+ * Apply a breathing effect
+ */
+bool BreathingPattern::render(const PatternFrame& frame, const PatternParams& params) {
+    // Calculate brightness based on the frame time, as beatsin8(params.speed)
+    uint8_t brightness = sin8(beatPhase8(frame.timeUs, params.speed));
+
+    // Apply brightness to the color
+    CHSV adjustedColor = CHSV(params.color.h, params.color.s, brightness);
+
+    // Fill all LEDs with the adjusted color
+    fill_solid(frame.leds, frame.numLeds, adjustedColor);
+    return true;
+}
+
+/**
+ * Build the gradient palette on first render
+ */
+void GradientPattern::begin(const PatternFrame& /*frame*/) {
+    _paletteValid = false;
+}
+
+/**
+ * Start the rainbow from the first hue
+ */
+void RainbowPattern::begin(const PatternFrame& /*frame*/) {
+    _palette.buildRainbow();
+    _lastUpdate = 0;
+    _step = 0;
+}
+
+/**
+ * Convert the colors on first render
+ */
+void ChasePattern::begin(const PatternFrame& /*frame*/) {
+    _colorsValid = false;
+}
+
+/**
+ * Convert the chase colors to RGB if they changed
+ */
+void ChasePattern::updateColors(const PatternParams& params) {
+    if (_colorsValid && sameHsv(params.color, _colorHsv) && sameHsv(params.secondaryColor, _backgroundHsv)) {
+        return;
+    }
+    _colorHsv = params.color;
+    _backgroundHsv = params.secondaryColor;
+    _color = params.color;
+    _background = params.secondaryColor;
+    _colorsValid = true;
+}
+
+/**
+ * Build the pulse color ramp on first render
+ */
+void PulsePattern::begin(const PatternFrame& /*frame*/) {
+    _rampValid = false;
+}
+
+/**
+ * Cache the color of every wave phase for one hue and saturation
+ */
+void PulsePattern::buildRamp(uint8_t hue, uint8_t sat) {
+    for (uint16_t phase = 0; phase < 256; phase++) {
+        _ramp[phase] = CHSV(hue, sat, sin8(phase));
+    }
+    _rampHue = hue;
+    _rampSat = sat;
+    _rampValid = true;
+}
+
+/**
+ * One heat cell per LED
+ */
+size_t FirePattern::scratchSize(uint16_t numLeds) const {
+    return numLeds;
+}
+
+void FirePattern::attachScratch(uint8_t* scratch) {
+    _heat = scratch;
+}
+
+/**
+ * Start the fire cold
+ */
+void FirePattern::begin(const PatternFrame& frame) {
+    _lastUpdate = 0;
+    if (_heat != nullptr) {
+        memset(_heat, 0, frame.numLeds);
+    }
+}
+
+/**
+ * One brightness value per LED
+ */
+size_t TwinklePattern::scratchSize(uint16_t numLeds) const {
+    return numLeds;
+}
+
+void TwinklePattern::attachScratch(uint8_t* scratch) {
+    _brightness = scratch;
+}
+
+/**
+ * Start with no sparkles
+ */
+void TwinklePattern::begin(const PatternFrame& frame) {
+    if (_brightness != nullptr) {
+        memset(_brightness, 0, frame.numLeds);
+    }
+}
+
+/**
+ * One weight per LED and source
+ */
+size_t FieldPattern::scratchSize(uint16_t numLeds) const {
+    return (size_t)numLeds * LEDPATTERNS_FIELD_SOURCES;
+}
+
+void FieldPattern::attachScratch(uint8_t* scratch) {
+    _weights = scratch;
+}
+
+/**
+ * Build the color ramp on first render
+ */
+void FieldPattern::begin(const PatternFrame& /*frame*/) {
+    _rampValid = false;
+}
+
+/**
+ * Precompute weight = 255 * exp(-d^2 / (2 * radius^2)) for every LED and source
+ */
+void FieldPattern::setSources(uint16_t numLeds, const uint16_t* positions, uint8_t count, uint16_t radius) {
+    if (_weights == nullptr) {
+        return;
+    }
+
+    _numSources = min(count, (uint8_t)LEDPATTERNS_FIELD_SOURCES);
+    float twoSigmaSquared = 2.0f * max(radius, (uint16_t)1) * max(radius, (uint16_t)1);
+
+    uint8_t* weights = _weights;
+    for (uint16_t i = 0; i < numLeds; i++) {
+        for (uint8_t s = 0; s < _numSources; s++) {
+            float d = (float)i - positions[s];
+            *weights++ = (uint8_t)(255.0f * expf(-(d * d) / twoSigmaSquared) + 0.5f);
+        }
+    }
+}
+
+/**
+ * Cache the color of every field intensity for one pair of end colors
+ */
+void FieldPattern::buildRamp(const CHSV& low, const CHSV& high) {
+    _ramp.buildGradient(low, high);
+    _rampLow = low;
+    _rampHigh = high;
+    _rampValid = true;
+}
+
+/**
+ * Apply an intensity field
+ */
+bool FieldPattern::render(const PatternFrame& frame, const PatternParams& params) {
+    if (_weights == nullptr) {
+        return false;
+    }
+
+    if (params.palette == nullptr &&
+        (!_rampValid || !sameHsv(params.color, _rampLow) || !sameHsv(params.secondaryColor, _rampHigh))) {
+        buildRamp(params.color, params.secondaryColor);
+    }
+    const Palette& palette = params.palette != nullptr ? *params.palette : _ramp;
+
+    // Without levels every LED is at zero intensity
+    const uint8_t* levels = params.levels;
+    const uint8_t numSources = levels != nullptr ? _numSources : 0;
+
+    const uint8_t* weights = _weights;
+    for (uint16_t i = 0; i < frame.numLeds; i++) {
+        // Sum of level * weight / 255 over the sources, saturating at 255
+        uint32_t sum = 0;
+        for (uint8_t s = 0; s < numSources; s++) {
+            sum += levels[s] * weights[s];
+        }
+        weights += _numSources;
+
+        // x * 257 >> 16 is x / 255 (rounded, within 0.53) and exact at full weight
+        sum = (sum * 257 + 0x8000) >> 16;
+        frame.leds[i] = palette[sum > 255 ? 255 : sum];
+    }
+    return true;
+}
@@ -0,0 +1,251 @@
+/**
+ * @file Patterns.h
+ * @brief Built-in LED patterns
+ *
+ * One class per PatternType. Patterns that animate keep their own timing
+ * and step counters, so e.g. rainbow and fire no longer share state.
+ *
+ * Patterns with a per-LED loop implement render() through a renderFor()
+ * template on the type of the LED count (PatternRender.h). render() passes
+ * the runtime frame.numLeds; FixedPattern<P, N> passes FixedLength<N>, so
+ * the same loop is compiled for a strip length known at compile time.
+ */
+
+#ifndef PATTERNS_H
+#define PATTERNS_H
+
+#include "Pattern.h"
+#include "PatternArena.h"
+#include "Palette.h"
+
+/**
+ * @brief LED count known at compile time
+ *
+ * Converts to N wherever a uint16_t count is used, as a constant.
+ */
+template <uint16_t N>
+struct FixedLength {
+    constexpr operator uint16_t() const {
+        return N;
+    }
+};
+
+/**
+ * @brief Solid color (params.color, or params.rgbColor with params.useRgb)
+ */
+class SolidPattern : public Pattern {
+public:
+    bool render(const PatternFrame& frame, const PatternParams& params) override;
+};
+
+/**
+ * @brief Whole strip breathing in params.color at params.speed
+ */
+class BreathingPattern : public Pattern {
+public:
+    bool render(const PatternFrame& frame, const PatternParams& params) override;
+};
+
+/**
+ * @brief Gradient from params.color to params.secondaryColor
+ *
+ * The gradient is expanded into a palette (the shortest way round the hue
+ * wheel) when either color changes; each LED then reads the entry for its
+ * position along the strip.
+ */
+class GradientPattern : public Pattern {
+public:
+    void begin(const PatternFrame& frame) override;
+    bool render(const PatternFrame& frame, const PatternParams& params) override {
+        return renderFor(frame, params, frame.numLeds);
+    }
+
+    template <class Length>
+    bool renderFor(const PatternFrame& frame, const PatternParams& params, Length numLeds);
+
+private:
+    Palette _palette;      // Gradient over the whole strip
+    CHSV _paletteStart;    // Colors the palette was built for
+    CHSV _paletteEnd;
+    bool _paletteValid;    // Whether the palette has been built
+};
+
+/**
+ * @brief Scrolling rainbow at params.speed
+ *
+ * Colors come from a rainbow palette built once, so a frame is a palette
+ * lookup per LED rather than an HSV conversion.
+ */
+class RainbowPattern : public Pattern {
+public:
+    void begin(const PatternFrame& frame) override;
+    bool render(const PatternFrame& frame, const PatternParams& params) override {
+        return renderFor(frame, params, frame.numLeds);
+    }
+
+    template <class Length>
+    bool renderFor(const PatternFrame& frame, const PatternParams& params, Length numLeds);
+
+private:
+    Palette _palette;      // CHSV(hue, 240, 255) for every hue
+    uint32_t _lastUpdate;  // Last update time
+    uint8_t _step;         // Current hue offset
+};
+
+/**
+ * @brief params.count chasers of params.size LEDs of params.color over
+ *        params.secondaryColor
+ *
+ * Chaser positions are 8.8 fixed point and derived from the frame time, so
+ * they move at the same speed at any frame rate. The LEDs at either end of
+ * a chaser are lit in proportion to how much of them it covers, so it
+ * glides between LEDs instead of stepping. Both colors are converted to RGB
+ * only when they change; each frame is then one flat background fill plus
+ * a blend of the size + 1 LEDs under each chaser.
+ */
+class ChasePattern : public Pattern {
+public:
+    void begin(const PatternFrame& frame) override;
+    bool render(const PatternFrame& frame, const PatternParams& params) override {
+        return renderFor(frame, params, frame.numLeds);
+    }
+
+    template <class Length>
+    bool renderFor(const PatternFrame& frame, const PatternParams& params, Length numLeds);
+
+private:
+    void updateColors(const PatternParams& params);
+    template <class Length>
+    void drawChaser(CRGB* leds, Length numLeds, uint32_t start, uint8_t size) const;
+
+    CRGB _color;           // params.color in RGB
+    CRGB _background;      // params.secondaryColor in RGB
+    CHSV _colorHsv;        // Colors the RGB values were converted from
+    CHSV _backgroundHsv;
+    bool _colorsValid;     // Whether the RGB values have been computed
+};
+
+/**
+ * @brief Sine wave of params.color travelling along the strip
+ *
+ * The color for every point of the wave is cached in a 256-entry ramp that
+ * is rebuilt only when the hue or saturation changes. Each frame computes
+ * the wave phase once and walks the ramp with a fixed per-LED step.
+ */
+class PulsePattern : public Pattern {
+public:
+    void begin(const PatternFrame& frame) override;
+    bool render(const PatternFrame& frame, const PatternParams& params) override {
+        return renderFor(frame, params, frame.numLeds);
+    }
+
+    template <class Length>
+    bool renderFor(const PatternFrame& frame, const PatternParams& params, Length numLeds);
+
+private:
+    void buildRamp(uint8_t hue, uint8_t sat);
+
+    Palette _ramp;         // CHSV(hue, sat, sin8(phase)) for every phase
+    uint8_t _rampHue;      // Hue the ramp was built for
+    uint8_t _rampSat;      // Saturation the ramp was built for
+    bool _rampValid;       // Whether the ramp has been built
+};
+
+/**
+ * @brief Fire2012 using params.cooling and params.sparking
+ */
+class FirePattern : public Pattern {
+public:
+    size_t scratchSize(uint16_t numLeds) const override;
+    void attachScratch(uint8_t* scratch) override;
+    void begin(const PatternFrame& frame) override;
+    bool render(const PatternFrame& frame, const PatternParams& params) override {
+        return renderFor(frame, params, frame.numLeds);
+    }
+
+    template <class Length>
+    bool renderFor(const PatternFrame& frame, const PatternParams& params, Length numLeds);
+
+private:
+    uint32_t _lastUpdate = 0;   // Last update time
+    uint8_t* _heat = nullptr;   // Heat value per LED (arena memory)
+};
+
+/**
+ * @brief Random sparkles of params.color fading out
+ *
+ * Keeps each LED's sparkle brightness in its own state rather than reading
+ * back the LED buffer, so it renders the same into any target buffer.
+ */
+class TwinklePattern : public Pattern {
+public:
+    size_t scratchSize(uint16_t numLeds) const override;
+    void attachScratch(uint8_t* scratch) override;
+    void begin(const PatternFrame& frame) override;
+    bool render(const PatternFrame& frame, const PatternParams& params) override {
+        return renderFor(frame, params, frame.numLeds);
+    }
+
+    template <class Length>
+    bool renderFor(const PatternFrame& frame, const PatternParams& params, Length numLeds);
+
+private:
+    uint8_t* _brightness = nullptr;  // Sparkle brightness per LED (arena memory)
+};
+
+/**
+ * @brief Per-LED intensity from several sources along the strip
+ *
+ * Each source (e.g. a sensor) sits at a position on the strip and its
+ * influence falls off as a gaussian with distance. The falloff is
+ * precomputed by setSources() into a table of 8-bit weights per LED and
+ * source, so a frame is one pass that takes the dot product of an LED's
+ * weights with params.levels and looks the result up in params.palette or,
+ * without one, in a ramp from params.color (zero intensity) to
+ * params.secondaryColor (full). The ramp is rebuilt only when either color
+ * changes.
+ */
+class FieldPattern : public Pattern {
+public:
+    size_t scratchSize(uint16_t numLeds) const override;
+    void attachScratch(uint8_t* scratch) override;
+    void begin(const PatternFrame& frame) override;
+    bool render(const PatternFrame& frame, const PatternParams& params) override;
+
+    /**
+     * @brief Place the sources and precompute the weight table
+     *
+     * @param numLeds Number of LEDs the pattern renders
+     * @param positions LED index of each source
+     * @param count Number of sources (at most LEDPATTERNS_FIELD_SOURCES)
+     * @param radius Gaussian sigma in LEDs
+     */
+    void setSources(uint16_t numLeds, const uint16_t* positions, uint8_t count, uint16_t radius);
+
+private:
+    void buildRamp(const CHSV& low, const CHSV& high);
+
+    uint8_t* _weights = nullptr;   // _numSources weights per LED (arena memory)
+    uint8_t _numSources = 0;       // Sources placed by setSources()
+    Palette _ramp;                 // Color for every field intensity
+    CHSV _rampLow;                 // Colors the ramp was built for
+    CHSV _rampHigh;
+    bool _rampValid;               // Whether the ramp has been built
+};
+
+/**
+ * @brief A pattern whose render loop is compiled for exactly N LEDs
+ *
+ * Must only be rendered into N-LED frames. Used by FixedLEDPatterns<N>.
+ */
+template <class P, uint16_t N>
+class FixedPattern : public P {
+public:
+    bool render(const PatternFrame& frame, const PatternParams& params) override {
+        return this->renderFor(frame, params, FixedLength<N>());
+    }
+};
+
+#include "PatternRender.h"
+
+#endif // PATTERNS_H
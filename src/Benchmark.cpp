@@ -0,0 +1,108 @@
+/**
+ * @file Benchmark.cpp
+ * @brief On-device sweep of every pattern with and without LED output
+ */
+
+#include "Benchmark.h"
+
+// Frames rendered per pattern in each of the two passes
+const uint16_t BENCHMARK_FRAMES = 300;
+
+// Field source levels (for however many sources setup() placed)
+static uint8_t benchmarkFieldLevels[LEDPATTERNS_FIELD_SOURCES];
+
+/**
+ * Parameters each pattern is benchmarked with (mid intensity in main.cpp)
+ */
+static PatternParams benchmarkParams(PatternType type) {
+  PatternParams params;
+  params.color = CHSV(96, 255, 255);
+  params.secondaryColor = CHSV(160, 128, 64);
+  params.speed = 20;
+  if (type == PATTERN_TWINKLE) {
+    params.chance = 25;
+  }
+  params.levels = benchmarkFieldLevels;
+  return params;
+}
+
+/**
+ * Check that a static frame stops being transmitted once dithering has settled
+ *
+ * A dim color leaves a fraction on every lit channel after gamma and
+ * brightness, which is the case that must not keep every frame on the wire.
+ */
+static void checkStaticSkipping(LEDPatternsBase& patterns, OutputStage& output, Print& out) {
+  PatternParams params;
+  params.color = CHSV(96, 255, 100);
+
+  uint32_t skippedBefore = output.getSkippedFrames();
+  uint32_t start = millis();
+  for (uint16_t frame = 0; frame < BENCHMARK_FRAMES; frame++) {
+    patterns.render(PATTERN_SOLID, params);
+    output.present();
+  }
+  output.waitIdle();
+  uint32_t skipped = output.getSkippedFrames() - skippedBefore;
+
+  // The first frame, the dither repeats and one refresh per second are sent
+  uint32_t transmitted = BENCHMARK_FRAMES - skipped;
+  uint32_t allowed = 1 + LED_DITHER_REPEAT_FRAMES + (millis() - start) / 1000 + 1;
+  out.printf("Static frames: %u of %u skipped (%s)\n",
+    (unsigned)skipped, (unsigned)BENCHMARK_FRAMES, transmitted <= allowed ? "ok" : "FAILED");
+}
+
+void runBenchmark(LEDPatternsBase& patterns, OutputStage& output, Print& out) {
+  // Every frame should be a fresh render of one pattern, not a cross-fade
+  patterns.setTransitionTime(0);
+  memset(benchmarkFieldLevels, 192, sizeof(benchmarkFieldLevels));
+
+  out.printf("Benchmark: %u LEDs, %u frames per pattern, %u MHz, times in us\n",
+    (unsigned)patterns.getNumLeds(), (unsigned)BENCHMARK_FRAMES, (unsigned)getCpuFrequencyMhz());
+  out.println("pattern      render avg  render max    show avg   fps (cpu)  fps (leds)");
+
+  for (uint8_t i = 0; i < NUM_PATTERNS; i++) {
+    PatternType type = (PatternType)i;
+    PatternParams params = benchmarkParams(type);
+
+    // Pass 1: render only. Throttled patterns (rainbow, fire) only do their
+    // full update every 20 ms, which shows up as avg well below max.
+    uint32_t renderTotalUs = 0;
+    uint32_t renderMaxUs = 0;
+    for (uint16_t frame = 0; frame < BENCHMARK_FRAMES; frame++) {
+      uint32_t start = micros();
+      patterns.render(type, params);
+      uint32_t renderUs = micros() - start;
+      renderTotalUs += renderUs;
+      renderMaxUs = max(renderMaxUs, renderUs);
+    }
+
+    // Pass 2: render and transmit every frame, pipelined as in the main loop
+    uint32_t showTotalUs = 0;
+    uint32_t passStart = micros();
+    for (uint16_t frame = 0; frame < BENCHMARK_FRAMES; frame++) {
+      patterns.render(type, params);
+      output.invalidate();
+      output.present();
+      showTotalUs += output.getLastShowUs();
+    }
+    output.waitIdle();
+    uint32_t passUs = micros() - passStart;
+
+    uint32_t renderAvgUs = renderTotalUs / BENCHMARK_FRAMES;
+    out.printf("%-12s %10u %11u %11u %11u %11u\n",
+      patternName(type),
+      (unsigned)renderAvgUs,
+      (unsigned)renderMaxUs,
+      (unsigned)(showTotalUs / BENCHMARK_FRAMES),
+      (unsigned)(1000000UL / max(renderMaxUs, (uint32_t)1)),
+      (unsigned)((uint64_t)BENCHMARK_FRAMES * 1000000UL / max(passUs, (uint32_t)1)));
+  }
+
+  checkStaticSkipping(patterns, output, out);
+
+  // Leave the strip dark for whatever runs next
+  patterns.solid(CRGB::Black);
+  output.present();
+  output.waitIdle();
+}
@@ -0,0 +1,75 @@
+/**
+ * @file ColorSchemes.cpp
+ * @brief Installation color schemes
+ */
+
+#include "ColorSchemes.h"
+
+/**
+ * @brief Gradient stops of one scheme
+ */
+struct ColorSchemeDefinition {
+  const char* name;
+  const PaletteStop* stops;
+  uint8_t count;
+};
+
+// SCHEME_CLASSIC is the original map(intensity, 0, 255, 160, 0) hue sweep
+const PaletteStop CLASSIC_STOPS[] = {
+  { 0, CHSV(160, 255, 255) },
+  { 255, CHSV(0, 255, 255) }
+};
+
+const PaletteStop OCEAN_STOPS[] = {
+  { 0, CHSV(176, 255, 255) },
+  { 160, CHSV(128, 255, 255) },
+  { 255, CHSV(128, 64, 255) }
+};
+
+const PaletteStop SUNSET_STOPS[] = {
+  { 0, CHSV(192, 255, 255) },
+  { 170, CHSV(255, 255, 255) },
+  { 171, CHSV(0, 255, 255) },
+  { 255, CHSV(40, 255, 255) }
+};
+
+const PaletteStop FOREST_STOPS[] = {
+  { 0, CHSV(128, 255, 255) },
+  { 255, CHSV(64, 255, 255) }
+};
+
+const PaletteStop EMBER_STOPS[] = {
+  { 0, CHSV(32, 96, 255) },
+  { 128, CHSV(24, 224, 255) },
+  { 255, CHSV(0, 255, 255) }
+};
+
+#define SCHEME(name, stops) { name, stops, sizeof(stops) / sizeof(stops[0]) }
+
+// Must stay in ColorSchemeId order
+const ColorSchemeDefinition COLOR_SCHEMES[NUM_COLOR_SCHEMES] = {
+  SCHEME("classic", CLASSIC_STOPS),
+  SCHEME("ocean", OCEAN_STOPS),
+  SCHEME("sunset", SUNSET_STOPS),
+  SCHEME("forest", FOREST_STOPS),
+  SCHEME("ember", EMBER_STOPS)
+};
+
+#undef SCHEME
+
+const char* colorSchemeName(ColorSchemeId id) {
+  return id < NUM_COLOR_SCHEMES ? COLOR_SCHEMES[id].name : "?";
+}
+
+void ColorScheme::select(ColorSchemeId id, uint8_t fieldFloor) {
+  _id = id < NUM_COLOR_SCHEMES ? id : SCHEME_CLASSIC;
+  const ColorSchemeDefinition& scheme = COLOR_SCHEMES[_id];
+
+  for (uint16_t i = 0; i < 256; i++) {
+    CHSV color = Palette::interpolate(scheme.stops, scheme.count, i);
+    _colors[i] = color;
+
+    // The field shows the strip between sensors dimly
+    _fieldPalette[i] = CHSV(color.h, color.s, lerp8by8(fieldFloor, color.v, i));
+  }
+}
@@ -0,0 +1,150 @@
+/**
+ * @file FrameProfiler.cpp
+ * @brief Cycle-counter histograms for each stage of a frame
+ */
+
+#include "FrameProfiler.h"
+
+#include <atomic>
+
+void CycleHistogram::reset() {
+  memset(_counts, 0, sizeof(_counts));
+  _samples = 0;
+  _totalCycles = 0;
+  _minCycles = UINT32_MAX;
+  _maxCycles = 0;
+}
+
+uint32_t CycleHistogram::percentile(uint8_t percent) const {
+  if (_samples == 0) {
+    return 0;
+  }
+
+  // Smallest bucket with at least percent% of the samples at or below it
+  uint32_t target = ((uint64_t)_samples * percent + 99) / 100;
+  uint32_t seen = 0;
+  for (uint8_t bucket = 0; bucket < NUM_BUCKETS; bucket++) {
+    seen += _counts[bucket];
+    if (seen >= target) {
+      return min(bucketUpperBound(bucket), _maxCycles);
+    }
+  }
+  return _maxCycles;
+}
+
+uint32_t CycleHistogram::bucketUpperBound(uint8_t bucket) {
+  if (bucket < 4) {
+    return bucket;
+  }
+  uint8_t shift = (bucket >> 2) - 1;
+  uint32_t lower = (uint32_t)(4 | (bucket & 3)) << shift;
+  return lower + ((1UL << shift) - 1);
+}
+
+#if FRAME_PROFILING
+
+// Names used in the report, in ProfileStage order
+static const char* const STAGE_NAMES[NUM_PROFILE_STAGES] = {
+  "sensor i2c",
+  "sensor proc",
+  "input",
+  "render",
+  "present",
+  "show",
+  "frame"
+};
+
+/**
+ * A histogram and the window its samples belong to
+ */
+struct ProfileSlot {
+  CycleHistogram histogram;
+  std::atomic<uint32_t> window{0};  // Set by the writer once cleared for a window
+};
+
+static ProfileSlot stageSlots[NUM_PROFILE_STAGES];
+static ProfileSlot patternSlots[NUM_PATTERNS];
+
+// Current window, advanced by the loop task (and only read by the writers)
+static std::atomic<uint32_t> profileWindow{1};
+
+// CPU clock the current window's cycles are counted at (0: not read yet)
+static uint32_t windowCpuMhz = 0;
+
+/**
+ * Record into a slot, first clearing it if it holds an earlier window
+ *
+ * Only the task that owns the slot calls this, so clearing never races
+ * with recording.
+ */
+static void recordInto(ProfileSlot& slot, uint32_t cycles) {
+  uint32_t window = profileWindow.load(std::memory_order_acquire);
+  if (slot.window.load(std::memory_order_relaxed) != window) {
+    slot.histogram.reset();
+    slot.window.store(window, std::memory_order_release);
+  }
+  slot.histogram.record(cycles);
+}
+
+void profileRecord(ProfileStage stage, uint32_t cycles) {
+  recordInto(stageSlots[stage], cycles);
+}
+
+void profileRecordPattern(PatternType type, uint32_t cycles) {
+  if (type < NUM_PATTERNS) {
+    recordInto(patternSlots[type], cycles);
+  }
+}
+
+/**
+ * Print one histogram as "name n min avg p99 max" in microseconds
+ */
+static void printHistogram(Print& out, const char* name, const CycleHistogram& histogram, uint32_t cyclesPerUs) {
+  out.printf("  %-12s %6u %7u %7u %7u %7u\n",
+    name,
+    (unsigned)histogram.getSamples(),
+    (unsigned)(histogram.getMinCycles() / cyclesPerUs),
+    (unsigned)(histogram.getAverageCycles() / cyclesPerUs),
+    (unsigned)(histogram.percentile(99) / cyclesPerUs),
+    (unsigned)(histogram.getMaxCycles() / cyclesPerUs));
+}
+
+/**
+ * Whether a slot holds samples of the window being reported
+ */
+static bool inWindow(const ProfileSlot& slot, uint32_t window) {
+  return slot.window.load(std::memory_order_acquire) == window && slot.histogram.getSamples() > 0;
+}
+
+void profileStartWindow() {
+  windowCpuMhz = getCpuFrequencyMhz();
+  profileWindow.fetch_add(1, std::memory_order_release);
+}
+
+void reportFrameProfile(Print& out) {
+  if (windowCpuMhz == 0) {
+    windowCpuMhz = getCpuFrequencyMhz();
+  }
+  uint32_t cyclesPerUs = max(windowCpuMhz, (uint32_t)1);
+  uint32_t window = profileWindow.load(std::memory_order_relaxed);
+
+  // Slots other tasks are still writing are read as they are; a sample in
+  // flight may be missing from some of the figures, nothing worse
+  out.printf("Profile (us at %u MHz):\n", (unsigned)windowCpuMhz);
+  out.println("                    n     min     avg     p99     max");
+  for (uint8_t i = 0; i < NUM_PROFILE_STAGES; i++) {
+    if (inWindow(stageSlots[i], window)) {
+      printHistogram(out, STAGE_NAMES[i], stageSlots[i].histogram, cyclesPerUs);
+    }
+  }
+  for (uint8_t i = 0; i < NUM_PATTERNS; i++) {
+    if (inWindow(patternSlots[i], window)) {
+      printHistogram(out, patternName((PatternType)i), patternSlots[i].histogram, cyclesPerUs);
+    }
+  }
+
+  // Every slot is cleared by its own task when it next records
+  profileStartWindow();
+}
+
+#endif // FRAME_PROFILING
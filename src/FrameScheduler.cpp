@@ -0,0 +1,135 @@
+/**
+ * @file FrameScheduler.cpp
+ * @brief Fixed-timestep frame pacing for the render loop
+ */
+
+#include "FrameScheduler.h"
+
+// Without the deadline timer, sleeps shorter than one tick are finished
+// with a short busy-wait
+const uint32_t TICK_PERIOD_US = portTICK_PERIOD_MS * 1000;
+
+FrameScheduler::FrameScheduler(uint16_t targetFps) :
+  _targetFps(0),
+  _periodUs(0),
+  _frameStartUs(0),
+  _deadlineUs(0),
+  _lastWorkUs(0),
+  _frameCount(0),
+  _overrunCount(0),
+  _worstOverrunUs(0),
+  _sleep(nullptr),
+  _sleepContext(nullptr),
+  _timer(nullptr),
+  _task(nullptr),
+  _timerFired(false)
+{
+  setTargetFps(targetFps);
+}
+
+void FrameScheduler::begin() {
+  _task = xTaskGetCurrentTaskHandle();
+  if (_timer == nullptr) {
+    esp_timer_create_args_t args = {};
+    args.callback = onDeadline;
+    args.arg = this;
+    args.dispatch_method = ESP_TIMER_TASK;
+    args.name = "frame";
+    if (esp_timer_create(&args, &_timer) != ESP_OK) {
+      _timer = nullptr;
+    }
+  }
+
+  _frameStartUs = micros();
+  _deadlineUs = _frameStartUs + _periodUs;
+}
+
+void FrameScheduler::setTargetFps(uint16_t targetFps) {
+  _targetFps = max(targetFps, (uint16_t)1);
+  _periodUs = 1000000UL / _targetFps;
+  _deadlineUs = _frameStartUs + _periodUs;
+}
+
+uint32_t FrameScheduler::waitForNextFrame() {
+  uint32_t now = micros();
+  _lastWorkUs = now - _frameStartUs;
+  _frameCount++;
+
+  int32_t slack = (int32_t)(_deadlineUs - now);
+  if (slack > 0) {
+    if (!sleepUntil(_deadlineUs)) {
+      // Woken early: start the next frame now
+      _deadlineUs = micros();
+    }
+  } else {
+    uint32_t overrun = (uint32_t)(-slack);
+    _overrunCount++;
+    _worstOverrunUs = max(_worstOverrunUs, overrun);
+
+    // Too far behind to catch up: drop the missed frames
+    if (overrun >= _periodUs) {
+      _deadlineUs = now;
+    }
+  }
+
+  _frameStartUs = _deadlineUs;
+  _deadlineUs += _periodUs;
+  return _frameStartUs;
+}
+
+bool FrameScheduler::startTimer(uint32_t us) {
+  _timerFired.store(false);
+  return esp_timer_start_once(_timer, us) == ESP_OK;
+}
+
+/**
+ * Deadline timer callback, on the esp_timer task: wake the render loop
+ */
+void FrameScheduler::onDeadline(void* context) {
+  FrameScheduler* scheduler = static_cast<FrameScheduler*>(context);
+  xTaskNotifyGive(scheduler->_task);
+  scheduler->_timerFired.store(true);
+}
+
+bool FrameScheduler::sleepUntil(uint32_t deadlineUs) {
+  int32_t remaining = (int32_t)(deadlineUs - micros());
+  if (remaining <= 0) {
+    return true;
+  }
+
+  if (_sleep != nullptr) {
+    if (!_sleep(remaining, _sleepContext)) {
+      return false;
+    }
+  } else if (_timer != nullptr && startTimer(remaining)) {
+    // The timer notifies this task at the deadline, so the whole slack is
+    // spent blocked; a notification from another task ends it early. The
+    // wait is bounded in case the timer is late.
+    ulTaskNotifyTake(pdTRUE, remaining / TICK_PERIOD_US + 2);
+
+    // The timer's notification must not be left to end the next sleep:
+    // cancel it, or wait for it if it is already on its way. Anything else
+    // still pending asked for the frame that is about to start anyway.
+    if (esp_timer_stop(_timer) != ESP_OK) {
+      while (!_timerFired.load()) {
+      }
+    }
+    ulTaskNotifyTake(pdTRUE, 0);
+    return (int32_t)(deadlineUs - micros()) <= 0;
+  } else {
+    // Hand whole ticks to the scheduler so the idle task can run. A wait
+    // of n ticks never sleeps longer than n tick periods, and ends when
+    // another task notifies this one.
+    uint32_t ticks = remaining / TICK_PERIOD_US;
+    if (ticks > 0 && ulTaskNotifyTake(pdTRUE, ticks) != 0) {
+      return false;
+    }
+  }
+
+  // Spin out the sub-tick remainder
+  int32_t left = (int32_t)(deadlineUs - micros());
+  if (left > 0) {
+    delayMicroseconds(left);
+  }
+  return true;
+}
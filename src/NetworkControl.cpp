@@ -0,0 +1,327 @@
+/**
+ * @file NetworkControl.cpp
+ * @brief Remote control and frame streaming over Wi-Fi (WIFI_SSID builds)
+ */
+
+#ifdef WIFI_SSID
+
+#include "NetworkControl.h"
+#include "SnapshotBuffer.h"
+
+#include <WiFi.h>
+#include <lwip/sockets.h>
+
+#include <atomic>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Task settings
+const uint32_t NETWORK_TASK_STACK_SIZE = 4096;  // Stack size in bytes
+const UBaseType_t NETWORK_TASK_PRIORITY = 1;    // Below the sensor task
+const BaseType_t NETWORK_TASK_CORE = 0;         // With the Wi-Fi stack, off the render core
+const uint32_t NETWORK_CONNECT_POLL_MS = 250;   // Delay between checks while joining the network
+
+// Longest control datagram read; the rest of a longer one is dropped
+const size_t CONTROL_PACKET_SIZE = 512;
+
+// DDP header (http://www.3waylabs.com/ddp/)
+const size_t DDP_HEADER_SIZE = 10;             // flags, sequence, type, id, offset (4), length (2)
+const size_t DDP_TIMECODE_SIZE = 4;            // Follows the header if DDP_FLAG_TIMECODE is set
+const uint8_t DDP_VERSION_MASK = 0xC0;
+const uint8_t DDP_VERSION_1 = 0x40;
+const uint8_t DDP_FLAG_TIMECODE = 0x10;
+const uint8_t DDP_FLAG_REPLY = 0x04;
+const uint8_t DDP_FLAG_QUERY = 0x02;
+const uint8_t DDP_FLAG_PUSH = 0x01;
+const uint8_t DDP_TYPE_KIND_MASK = 0x38;       // Data type bits TTT: 0 undefined, 1 RGB
+const uint8_t DDP_TYPE_RGB = 0x08;
+const uint8_t DDP_ID_DISPLAY = 1;              // Default output device
+const uint8_t DDP_ID_ALL = 255;                // Every device
+
+/**
+ * @brief One streamed frame, in the render buffer's RGB byte order
+ */
+struct StreamFrame {
+  CRGB leds[LED_COUNT];
+};
+
+const size_t STREAM_FRAME_BYTES = sizeof(StreamFrame);
+
+// Frames filled in place by the network task and presented by the render loop
+static SnapshotBuffer<StreamFrame> streamFrames;
+static std::atomic<uint32_t> streamFrameCount(0);
+static std::atomic<uint32_t> lastStreamFrameMs(0);
+
+// Settings, changed by the network task only and published to the render loop
+static RemoteSettings settings;
+static SnapshotBuffer<RemoteSettings> settingsSnapshots;
+
+/**
+ * Open a non-blocking UDP socket listening on every interface
+ *
+ * @return Socket, or -1 on failure
+ */
+static int openUdpSocket(uint16_t port) {
+  int sock = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+  if (sock < 0) {
+    return -1;
+  }
+
+  sockaddr_in address = {};
+  address.sin_family = AF_INET;
+  address.sin_port = htons(port);
+  address.sin_addr.s_addr = htonl(INADDR_ANY);
+  if (bind(sock, reinterpret_cast<sockaddr*>(&address), sizeof(address)) < 0) {
+    close(sock);
+    return -1;
+  }
+
+  fcntl(sock, F_SETFL, O_NONBLOCK);
+  return sock;
+}
+
+/**
+ * Receive one DDP packet, its pixel data straight into the back stream frame
+ *
+ * The header is peeked first, so the datagram can then be scattered: the
+ * header into a scratch buffer and the data to its offset in the frame.
+ * Data beyond the end of the strip is dropped with the rest of the datagram.
+ *
+ * @return false if no packet was waiting
+ */
+static bool receiveDdpPacket(int sock) {
+  uint8_t header[DDP_HEADER_SIZE + DDP_TIMECODE_SIZE] = {};
+  ssize_t peeked = recv(sock, header, sizeof(header), MSG_PEEK);
+  if (peeked < 0) {
+    return false;
+  }
+
+  uint8_t flags = header[0];
+  size_t headerSize = DDP_HEADER_SIZE + ((flags & DDP_FLAG_TIMECODE) ? DDP_TIMECODE_SIZE : 0);
+  uint8_t type = header[2];
+  uint8_t id = header[3];
+  bool valid = (size_t)peeked >= headerSize &&
+               (flags & DDP_VERSION_MASK) == DDP_VERSION_1 &&
+               (flags & (DDP_FLAG_REPLY | DDP_FLAG_QUERY)) == 0 &&
+               (type == 0 || (type & DDP_TYPE_KIND_MASK) == DDP_TYPE_RGB) &&
+               (id == DDP_ID_DISPLAY || id == DDP_ID_ALL);
+  if (!valid) {
+    // Reading one byte discards the whole datagram
+    recv(sock, header, 1, 0);
+    return true;
+  }
+
+  uint32_t offset = ((uint32_t)header[4] << 24) | ((uint32_t)header[5] << 16) |
+                    ((uint32_t)header[6] << 8) | header[7];
+  uint16_t length = (header[8] << 8) | header[9];
+
+  uint8_t* frame = reinterpret_cast<uint8_t*>(streamFrames.back().leds);
+  size_t fits = offset < STREAM_FRAME_BYTES ? min((size_t)length, STREAM_FRAME_BYTES - offset) : 0;
+
+  iovec parts[2];
+  parts[0].iov_base = header;
+  parts[0].iov_len = headerSize;
+  parts[1].iov_base = frame + (fits > 0 ? offset : 0);
+  parts[1].iov_len = fits;
+
+  msghdr message = {};
+  message.msg_iov = parts;
+  message.msg_iovlen = 2;
+  if (recvmsg(sock, &message, 0) < 0) {
+    return false;
+  }
+
+  if (flags & DDP_FLAG_PUSH) {
+    streamFrames.commit();
+    lastStreamFrameMs.store(millis(), std::memory_order_relaxed);
+    streamFrameCount.fetch_add(1, std::memory_order_release);
+  }
+  return true;
+}
+
+/**
+ * Parse an unsigned decimal value within a range
+ *
+ * @return false if text isn't a number or is out of range
+ */
+static bool parseNumber(const char* text, uint32_t maximum, uint32_t& value) {
+  char* end;
+  unsigned long parsed = strtoul(text, &end, 10);
+  if (end == text || *end != '\0' || parsed > maximum) {
+    return false;
+  }
+  value = parsed;
+  return true;
+}
+
+/**
+ * Apply one "key=value" command to the settings
+ *
+ * @return false if the key is unknown or the value invalid
+ */
+static bool applyCommand(const char* key, const char* value) {
+  uint32_t number;
+
+  if (strcmp(key, "pattern") == 0) {
+    if (strcmp(value, "auto") == 0) {
+      settings.pattern = NUM_PATTERNS;
+      return true;
+    }
+    for (uint8_t i = 0; i < NUM_PATTERNS; i++) {
+      if (strcmp(value, patternName((PatternType)i)) == 0) {
+        settings.pattern = (PatternType)i;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  if (strcmp(key, "brightness") == 0 && parseNumber(value, 255, number)) {
+    settings.brightness = number;
+  } else if (strcmp(key, "hue") == 0 && parseNumber(value, 255, number)) {
+    settings.hue = number;
+  } else if (strcmp(key, "speed") == 0 && parseNumber(value, 255, number)) {
+    settings.speed = number;
+  } else if (strcmp(key, "transition") == 0 && parseNumber(value, UINT16_MAX, number)) {
+    settings.transitionMs = number;
+  } else if (strcmp(key, "presence_threshold") == 0 && parseNumber(value, INT16_MAX, number)) {
+    settings.sensor.thresholds.presence = number;
+  } else if (strcmp(key, "motion_threshold") == 0 && parseNumber(value, 255, number)) {
+    settings.sensor.thresholds.motion = number;
+  } else if (strcmp(key, "hysteresis") == 0 && parseNumber(value, 255, number)) {
+    settings.sensor.thresholds.hysteresis = number;
+  } else if (strcmp(key, "odr") == 0 && parseNumber(value, 255, number) && isSensorOdrSupported(number)) {
+    settings.sensor.odrHz = number;
+  } else if (strcmp(key, "presence_scale") == 0 && parseNumber(value, 255, number)) {
+    settings.sensor.presenceScale = number;
+  } else if (strcmp(key, "motion_scale") == 0 && parseNumber(value, 255, number)) {
+    settings.sensor.motionScale = number;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+/**
+ * Receive one control datagram, apply its commands and reply to the sender
+ *
+ * @return false if no datagram was waiting
+ */
+static bool receiveControlPacket(int sock) {
+  char packet[CONTROL_PACKET_SIZE + 1];
+  sockaddr_in sender;
+  socklen_t senderSize = sizeof(sender);
+  ssize_t received = recvfrom(sock, packet, CONTROL_PACKET_SIZE, 0,
+                              reinterpret_cast<sockaddr*>(&sender), &senderSize);
+  if (received < 0) {
+    return false;
+  }
+  packet[received] = '\0';
+
+  // Replies "ok", or names the first command that wasn't applied
+  char reply[64] = "ok\n";
+  bool accepted = false;
+  bool rejected = false;
+  char* context;
+  for (char* line = strtok_r(packet, "\r\n", &context); line != nullptr;
+       line = strtok_r(nullptr, "\r\n", &context)) {
+    char* value = strchr(line, '=');
+    if (value != nullptr) {
+      *value++ = '\0';
+    }
+    if (value != nullptr && applyCommand(line, value)) {
+      accepted = true;
+    } else if (!rejected) {
+      snprintf(reply, sizeof(reply), "error %s\n", line);
+      rejected = true;
+    }
+  }
+
+  if (accepted) {
+    settings.sequence++;
+    settingsSnapshots.publish(settings);
+  }
+
+  sendto(sock, reply, strlen(reply), 0, reinterpret_cast<sockaddr*>(&sender), senderSize);
+  return true;
+}
+
+/**
+ * Network task body: join the network, then serve both ports forever
+ */
+static void networkTask(void* /*parameter*/) {
+  // Modem sleep would add up to a beacon interval of latency to every packet
+  WiFi.mode(WIFI_STA);
+  WiFi.setSleep(false);
+  WiFi.setAutoReconnect(true);
+  WiFi.begin(WIFI_SSID, WIFI_PASSWORD);
+  while (WiFi.status() != WL_CONNECTED) {
+    vTaskDelay(pdMS_TO_TICKS(NETWORK_CONNECT_POLL_MS));
+  }
+  Serial.print("Wi-Fi connected, address ");
+  Serial.println(WiFi.localIP());
+
+  // Bound to every interface, so the sockets survive reconnects
+  int ddpSocket = openUdpSocket(NETWORK_DDP_PORT);
+  int controlSocket = openUdpSocket(NETWORK_CONTROL_PORT);
+  if (ddpSocket < 0 || controlSocket < 0) {
+    Serial.println("Failed to open network sockets");
+    vTaskDelete(nullptr);
+    return;
+  }
+
+  for (;;) {
+    fd_set readable;
+    FD_ZERO(&readable);
+    FD_SET(ddpSocket, &readable);
+    FD_SET(controlSocket, &readable);
+    if (select(max(ddpSocket, controlSocket) + 1, &readable, nullptr, nullptr, nullptr) <= 0) {
+      continue;
+    }
+
+    // Drain every waiting frame packet before looking at commands
+    if (FD_ISSET(ddpSocket, &readable)) {
+      while (receiveDdpPacket(ddpSocket)) {
+      }
+    }
+    if (FD_ISSET(controlSocket, &readable)) {
+      while (receiveControlPacket(controlSocket)) {
+      }
+    }
+  }
+}
+
+bool startNetworkTask(const RemoteSettings& initial) {
+  settings = initial;
+
+  BaseType_t result = xTaskCreatePinnedToCore(
+    networkTask,
+    "network",
+    NETWORK_TASK_STACK_SIZE,
+    nullptr,
+    NETWORK_TASK_PRIORITY,
+    nullptr,
+    NETWORK_TASK_CORE);
+
+  return result == pdPASS;
+}
+
+bool readRemoteSettings(RemoteSettings& out) {
+  return settingsSnapshots.read(out);
+}
+
+const CRGB* acquireStreamFrame(bool& fresh) {
+  fresh = streamFrames.acquire();
+  if (streamFrameCount.load(std::memory_order_acquire) == 0 ||
+      millis() - lastStreamFrameMs.load(std::memory_order_relaxed) >= NETWORK_STREAM_TIMEOUT_MS) {
+    return nullptr;
+  }
+  return streamFrames.front().leds;
+}
+
+uint32_t getStreamFrameCount() {
+  return streamFrameCount.load(std::memory_order_relaxed);
+}
+
+#endif // WIFI_SSID
@@ -0,0 +1,306 @@
+/**
+ * @file OutputStage.cpp
+ * @brief Double-buffered LED output running on its own task
+ */
+
+#include "OutputStage.h"
+#include "FrameProfiler.h"
+#include "IntensityMap.h"
+
+// Task settings
+const uint32_t OUTPUT_TASK_STACK_SIZE = 4096;  // Stack size in bytes
+const UBaseType_t OUTPUT_TASK_PRIORITY = 3;    // Above the loop task so transmission starts immediately
+const BaseType_t OUTPUT_TASK_CORE = 1;         // Same core as the render loop; the task mostly blocks
+
+// Unchanged frames are still retransmitted this often
+const uint32_t OUTPUT_REFRESH_INTERVAL_MS = 1000;
+
+// WS2812B current model (same figures as FastLED's power management)
+const uint8_t LED_RED_MA = 16;    // Red channel at full value
+const uint8_t LED_GREEN_MA = 11;  // Green channel at full value
+const uint8_t LED_BLUE_MA = 15;   // Blue channel at full value
+const uint8_t LED_IDLE_MA = 1;    // Each LED while dark
+
+/**
+ * @brief Output level of every 8-bit value in 8.8 fixed point, at full brightness
+ *
+ * Tops out at 255.0 rather than 65535 so a level plus a carried fraction
+ * still rounds to at most 255.
+ */
+struct GammaTable {
+  uint16_t levels[256];
+};
+
+constexpr GammaTable makeGammaTable() {
+  GammaTable table = {};
+  for (int v = 0; v < 256; v++) {
+    double level = intensity_math::pow(v / 255.0, LED_GAMMA_X100 / 100.0) * 255.0 * 256.0;
+    table.levels[v] = (uint16_t)(level + 0.5);
+  }
+  return table;
+}
+
+constexpr GammaTable GAMMA_TABLE = makeGammaTable();
+
+static_assert(GAMMA_TABLE.levels[255] == 255 << 8, "Full value must map to full output");
+
+/**
+ * Gamma correct and scale one channel, then round it to 8 bits
+ *
+ * @param value Rendered value
+ * @param scale Brightness, 0-256
+ * @param residual Fraction carried from this channel's last frame (dithering)
+ * @param ditherMask 0xFF to carry the fraction, 0 to drop it (and clear residual)
+ * @param fractions ORed with the fraction of the level (dithering)
+ */
+static inline uint8_t shadeChannel(uint8_t value, uint16_t scale, uint8_t& residual, uint8_t ditherMask,
+                                   uint8_t& fractions) {
+  uint32_t level = ((uint32_t)GAMMA_TABLE.levels[value] * scale) >> 8;
+#if LED_TEMPORAL_DITHER
+  level += residual;
+  residual = (uint8_t)level & ditherMask;
+  fractions |= (uint8_t)level;
+#else
+  // Without dithering the fraction is dropped and nothing is pending
+  (void)residual;
+  (void)ditherMask;
+  (void)fractions;
+#endif
+  return level >> 8;
+}
+
+/**
+ * Registers a FastLED controller for every entry of LED_SEGMENT_TABLE.
+ *
+ * FastLED takes the data pin as a template argument, so the table is walked
+ * at compile time; segment I lives at front + (sum of earlier counts).
+ */
+template <size_t I>
+struct SegmentControllers {
+  static void add(CRGB* front) {
+    SegmentControllers<I - 1>::add(front);
+    FastLED.addLeds<WS2812B, LED_SEGMENT_TABLE[I - 1].pin, GRB>(
+      front + physicalOffset(), LED_SEGMENT_TABLE[I - 1].count);
+  }
+
+  static constexpr uint32_t physicalOffset() {
+    return SegmentControllers<I - 1>::physicalOffset() + LED_SEGMENT_TABLE[I - 2].count;
+  }
+};
+
+template <>
+struct SegmentControllers<1> {
+  static void add(CRGB* front) {
+    FastLED.addLeds<WS2812B, LED_SEGMENT_TABLE[0].pin, GRB>(front, LED_SEGMENT_TABLE[0].count);
+  }
+
+  static constexpr uint32_t physicalOffset() {
+    return 0;
+  }
+};
+
+OutputStage::OutputStage(CRGB* renderBuffer) :
+  _render(renderBuffer),
+  _ditherEnabled(true),
+  _ditherPending(false),
+  _ditherRepeats(0),
+  _frameHash(0),
+  _task(nullptr),
+  _idle(nullptr),
+  _lastShowUs(0),
+  _lastWaitUs(0),
+  _lastTransmitMs(0),
+  _skippedFrames(0),
+  _forceTransmit(true),
+  _brightness(255),
+  _appliedBrightness(255),
+  _estimatedMa(0),
+  _limitedFrames(0)
+{
+}
+
+bool OutputStage::begin() {
+  SegmentControllers<LED_SEGMENT_COUNT>::add(_front);
+
+  // Brightness and dithering are applied when the front buffer is written
+  FastLED.setBrightness(255);
+  FastLED.setDither(DISABLE_DITHER);
+
+#if LED_TEMPORAL_DITHER
+  // Start the carried fractions spread out, so LEDs at the same level
+  // don't all step up on the same frame
+  for (uint32_t i = 0; i < sizeof(_residual); i++) {
+    _residual[i] = i * 151;
+  }
+#endif
+
+  _idle = xSemaphoreCreateBinary();
+  if (_idle == nullptr) {
+    return false;
+  }
+  xSemaphoreGive(_idle);
+
+  BaseType_t result = xTaskCreatePinnedToCore(
+    outputTask,
+    "output",
+    OUTPUT_TASK_STACK_SIZE,
+    this,
+    OUTPUT_TASK_PRIORITY,
+    &_task,
+    OUTPUT_TASK_CORE);
+
+  return result == pdPASS;
+}
+
+bool OutputStage::present(const CRGB* frame, bool changed) {
+  // A frame with a fraction still to carry is sent again even if unchanged,
+  // for a few frames after each change
+  uint32_t ms = millis();
+  bool ditherDue = _ditherPending && _ditherRepeats < LED_DITHER_REPEAT_FRAMES;
+  bool transmitDue = _forceTransmit || ms - _lastTransmitMs >= OUTPUT_REFRESH_INTERVAL_MS;
+  if (!transmitDue && !ditherDue && !changed) {
+    _skippedFrames++;
+    return false;
+  }
+
+  // Only reads the frame, so it runs while the previous frame is still on
+  // the wire
+  FrameSums sums;
+  uint32_t hash = analyseFrame(frame, sums);
+  bool repeated = hash == _frameHash;
+  if (!transmitDue && !ditherDue && repeated) {
+    _skippedFrames++;
+    return false;
+  }
+  if (!repeated || _forceTransmit) {
+    // New content, or brightness or dithering changed the output
+    _ditherRepeats = 0;
+  } else if (_ditherRepeats < LED_DITHER_REPEAT_FRAMES) {
+    _ditherRepeats++;
+  }
+  _frameHash = hash;
+  _forceTransmit = false;
+  _lastTransmitMs = ms;
+
+  // The front buffer is busy until the previous frame has left the wire
+  uint32_t waitStart = micros();
+  xSemaphoreTake(_idle, portMAX_DELAY);
+  _lastWaitUs = micros() - waitStart;
+
+  writeFront(frame, applyPowerLimit(sums));
+
+  xTaskNotifyGive(_task);
+  return true;
+}
+
+/**
+ * Hash the part of a frame shown on the strips and sum its
+ * gamma-corrected channels (once per strip, so mirrored ranges count twice)
+ *
+ * @param sums Receives the channel sums
+ * @return FNV-1a hash over the LEDs, one 24-bit word per LED
+ */
+uint32_t OutputStage::analyseFrame(const CRGB* frame, FrameSums& sums) const {
+  uint32_t hash = 2166136261u;
+  for (size_t s = 0; s < LED_SEGMENT_COUNT; s++) {
+    const LEDSegment& segment = LED_SEGMENT_TABLE[s];
+    const CRGB* in = frame + segment.start;
+    for (uint16_t i = 0; i < segment.count; i++, in++) {
+      hash = (hash ^ (in->r | (in->g << 8) | ((uint32_t)in->b << 16))) * 16777619u;
+      sums.red += GAMMA_TABLE.levels[in->r];
+      sums.green += GAMMA_TABLE.levels[in->g];
+      sums.blue += GAMMA_TABLE.levels[in->b];
+    }
+  }
+  return hash;
+}
+
+/**
+ * Estimate the frame's current and pick a brightness within the power budget
+ *
+ * @return Brightness to write the frame at
+ */
+uint8_t OutputStage::applyPowerLimit(const FrameSums& sums) {
+  const uint32_t idleMa = LED_PHYSICAL_COUNT * LED_IDLE_MA;
+
+  // Current drawn by the lit channels at brightness 255
+  uint32_t fullMa = ((sums.red >> 8) * LED_RED_MA + (sums.green >> 8) * LED_GREEN_MA +
+                     (sums.blue >> 8) * LED_BLUE_MA) / 255;
+
+  uint8_t brightness = _brightness;
+  uint32_t estimatedMa = idleMa + fullMa * brightness / 255;
+
+  if (LED_POWER_BUDGET_MA > 0 && estimatedMa > LED_POWER_BUDGET_MA && fullMa > 0) {
+    uint32_t availableMa = LED_POWER_BUDGET_MA > idleMa ? LED_POWER_BUDGET_MA - idleMa : 0;
+    brightness = availableMa * 255 / fullMa;
+    estimatedMa = idleMa + fullMa * brightness / 255;
+    _limitedFrames++;
+  }
+
+  _appliedBrightness = brightness;
+  _estimatedMa = estimatedMa;
+  return brightness;
+}
+
+/**
+ * Split a frame onto the strips, gamma corrected, scaled and
+ * dithered, in one pass
+ */
+void OutputStage::writeFront(const CRGB* frame, uint8_t brightness) {
+  // 0-255 to 0-256, so full brightness is exact
+  const uint16_t scale = brightness + (brightness >> 7);
+  const uint8_t ditherMask = _ditherEnabled ? 0xFF : 0;
+  uint8_t fractions = 0;
+
+#if LED_TEMPORAL_DITHER
+  uint8_t* residual = _residual;
+#else
+  uint8_t residual[3] = {};
+#endif
+
+  CRGB* out = _front;
+  for (size_t s = 0; s < LED_SEGMENT_COUNT; s++) {
+    const LEDSegment& segment = LED_SEGMENT_TABLE[s];
+    const CRGB* in = frame + segment.start;
+    int step = 1;
+    if (segment.reversed) {
+      in += segment.count - 1;
+      step = -1;
+    }
+    for (uint16_t i = 0; i < segment.count; i++, in += step) {
+      out[i].r = shadeChannel(in->r, scale, residual[0], ditherMask, fractions);
+      out[i].g = shadeChannel(in->g, scale, residual[1], ditherMask, fractions);
+      out[i].b = shadeChannel(in->b, scale, residual[2], ditherMask, fractions);
+#if LED_TEMPORAL_DITHER
+      residual += 3;
+#endif
+    }
+    out += segment.count;
+  }
+
+  _ditherPending = LED_TEMPORAL_DITHER && _ditherEnabled && fractions != 0;
+}
+
+void OutputStage::waitIdle() {
+  xSemaphoreTake(_idle, portMAX_DELAY);
+  xSemaphoreGive(_idle);
+}
+
+/**
+ * Output task body: transmit the front buffer each time a frame is presented
+ */
+void OutputStage::outputTask(void* parameter) {
+  OutputStage* stage = static_cast<OutputStage*>(parameter);
+
+  for (;;) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+    uint32_t start = micros();
+    uint32_t startCycles = profileCycles();
+    FastLED.show();
+    profileRecord(PROFILE_SHOW, profileCycles() - startCycles);
+    stage->_lastShowUs = micros() - start;
+
+    xSemaphoreGive(stage->_idle);
+  }
+}
@@ -0,0 +1,103 @@
+/**
+ * @file PowerMode.cpp
+ * @brief Lower frame rate, sensor rate and CPU clock while the room is empty
+ */
+
+#include "PowerMode.h"
+#include "FrameProfiler.h"
+#include "SensorTask.h"
+
+#include <esp_sleep.h>
+
+// Light sleep stops the radio, so Wi-Fi builds idle in the scheduler instead
+#if POWER_LIGHT_SLEEP && !defined(WIFI_SSID)
+#define POWER_USE_LIGHT_SLEEP 1
+#else
+#define POWER_USE_LIGHT_SLEEP 0
+#endif
+
+PowerMode::PowerMode(FrameScheduler& scheduler, OutputStage& output) :
+  _scheduler(scheduler),
+  _output(output),
+  _activeFps(0),
+  _activeCpuMhz(0),
+  _lastActiveMs(0),
+  _idle(false),
+  _idleCount(0)
+{
+}
+
+void PowerMode::begin() {
+  _lastActiveMs = millis();
+}
+
+bool PowerMode::update(bool active) {
+  uint32_t ms = millis();
+  if (active) {
+    _lastActiveMs = ms;
+    if (_idle) {
+      exitIdle();
+    }
+#if POWER_IDLE_AFTER_MS > 0
+  } else if (!_idle && ms - _lastActiveMs >= POWER_IDLE_AFTER_MS) {
+    enterIdle();
+#endif
+  }
+  return _idle;
+}
+
+void PowerMode::enterIdle() {
+  _idle = true;
+  _idleCount++;
+  _activeFps = _scheduler.getTargetFps();
+  _activeCpuMhz = getCpuFrequencyMhz();
+
+  _scheduler.setTargetFps(POWER_IDLE_FPS);
+  _output.setTemporalDither(false);
+  requestSensorIdle(POWER_IDLE_ODR_HZ);
+  setCpuFrequencyMhz(POWER_IDLE_CPU_MHZ);
+  profileStartWindow();
+#if POWER_USE_LIGHT_SLEEP
+  _scheduler.setSleepFunction(lightSleep, this);
+#endif
+}
+
+void PowerMode::exitIdle() {
+  _idle = false;
+
+  // Clock first, so the frames that follow run at full speed
+  setCpuFrequencyMhz(_activeCpuMhz);
+  profileStartWindow();
+  _scheduler.setSleepFunction(nullptr);
+  _scheduler.setTargetFps(_activeFps);
+  _output.setTemporalDither(true);
+  requestSensorIdle(0);
+}
+
+/**
+ * Spend the time to the next idle frame in light sleep
+ *
+ * Both cores stop, so the sensor task is asked to check the sensors on
+ * wake-up: data-ready edges and its timeouts don't advance while asleep.
+ */
+bool PowerMode::lightSleep(uint32_t us, void* context) {
+  PowerMode* mode = static_cast<PowerMode*>(context);
+
+  // The strips must not be mid-transmission when the clocks stop
+  uint32_t start = micros();
+  mode->_output.waitIdle();
+  uint32_t waited = micros() - start;
+  if (waited >= us) {
+    return true;
+  }
+
+  // The sensor task already woke the render loop up
+  if (ulTaskNotifyTake(pdTRUE, 0) != 0) {
+    return false;
+  }
+
+  esp_sleep_enable_timer_wakeup(us - waited);
+  esp_light_sleep_start();
+  pollSensorsNow();
+  return true;
+}
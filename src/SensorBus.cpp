@@ -0,0 +1,121 @@
+/**
+ * @file SensorBus.cpp
+ * @brief I2C access to one or more STHS34PF80 presence sensors
+ */
+
+#include "SensorBus.h"
+
+#include <SparkFun_STHS34PF80_Arduino_Library.h>
+
+// STHS34PF80 registers read on the hot path
+const uint8_t REG_STATUS = 0x23;               // Bit 2: DRDY
+const uint8_t REG_FUNC_STATUS = 0x25;          // Bit 2: PRES_FLAG, bit 1: MOT_FLAG; reading clears DRDY
+const uint8_t REG_TPRESENCE_L = 0x3A;          // TPRESENCE_L/H then TMOTION_L/H
+const uint8_t STATUS_DRDY = 0x04;
+const uint8_t FUNC_STATUS_PRES_FLAG = 0x04;
+const uint8_t FUNC_STATUS_MOT_FLAG = 0x02;
+
+// Back-off after a failed transaction: doubles per failure up to the cap
+const uint32_t BACKOFF_MIN_MS = 20;
+const uint32_t BACKOFF_MAX_MS = 1000;
+
+bool SensorBus::select(const SensorPort& port) {
+  if (port.muxChannel < 0 || (port.wire == _muxWire && port.muxChannel == _muxChannel)) {
+    return true;
+  }
+
+  port.wire->beginTransmission(MUX_ADDRESS);
+  port.wire->write((uint8_t)(1 << port.muxChannel));
+  bool ok = port.wire->endTransmission() == 0;
+
+  // After a failure the mux state is unknown; select again next time
+  _muxWire = ok ? port.wire : nullptr;
+  _muxChannel = ok ? port.muxChannel : -1;
+  return ok;
+}
+
+bool SensorBus::addSensor(const SensorPort& port) {
+  if (_count >= MAX_SENSORS) {
+    return false;
+  }
+  _sensors[_count] = Sensor();
+  _sensors[_count].port = port;
+  _count++;
+  return true;
+}
+
+bool SensorBus::isReady(uint8_t index, uint32_t nowMs) {
+  Sensor& sensor = _sensors[index];
+  if (inBackoff(sensor, nowMs)) {
+    return false;
+  }
+
+  // Latched DRDY holds INT high until the sample is read
+  if (sensor.port.intPin >= 0) {
+    return digitalRead(sensor.port.intPin) == HIGH;
+  }
+
+  uint8_t status = 0;
+  bool ok = readRegisters(sensor.port, REG_STATUS, &status, 1);
+  recordResult(sensor, ok, nowMs);
+  return ok && (status & STATUS_DRDY) != 0;
+}
+
+bool SensorBus::read(uint8_t index, uint32_t nowMs, SensorSample& out) {
+  Sensor& sensor = _sensors[index];
+  if (inBackoff(sensor, nowMs)) {
+    return false;
+  }
+
+  // The flags and the outputs aren't adjacent, so this is two bursts
+  uint8_t status = 0;
+  uint8_t values[4];
+  bool ok = readRegisters(sensor.port, REG_FUNC_STATUS, &status, 1) &&
+            readRegisters(sensor.port, REG_TPRESENCE_L, values, sizeof(values));
+  recordResult(sensor, ok, nowMs);
+  if (!ok) {
+    return false;
+  }
+
+  out.presenceFlag = (status & FUNC_STATUS_PRES_FLAG) != 0;
+  out.motionFlag = (status & FUNC_STATUS_MOT_FLAG) != 0;
+  out.presenceValue = (int16_t)(values[0] | (values[1] << 8));
+  out.motionValue = (int16_t)(values[2] | (values[3] << 8));
+  return true;
+}
+
+/**
+ * Read consecutive registers in one transaction (repeated start, auto-increment)
+ */
+bool SensorBus::readRegisters(const SensorPort& port, uint8_t reg, uint8_t* data, uint8_t length) {
+  if (!select(port)) {
+    return false;
+  }
+
+  TwoWire* wire = port.wire;
+  wire->beginTransmission(STHS34PF80_I2C_ADDRESS);
+  wire->write(reg);
+  if (wire->endTransmission(false) != 0) {
+    return false;
+  }
+  if (wire->requestFrom((uint8_t)STHS34PF80_I2C_ADDRESS, length) != length) {
+    return false;
+  }
+  return wire->readBytes(data, length) == length;
+}
+
+bool SensorBus::inBackoff(const Sensor& sensor, uint32_t nowMs) const {
+  return sensor.failures > 0 && (int32_t)(nowMs - sensor.retryAtMs) < 0;
+}
+
+void SensorBus::recordResult(Sensor& sensor, bool ok, uint32_t nowMs) {
+  if (ok) {
+    sensor.failures = 0;
+    return;
+  }
+
+  _errorCount++;
+  sensor.failures = min(sensor.failures + 1, 16);
+  uint32_t backoffMs = min(BACKOFF_MIN_MS << (sensor.failures - 1), BACKOFF_MAX_MS);
+  sensor.retryAtMs = nowMs + backoffMs;
+}
@@ -0,0 +1,98 @@
+/**
+ * @file SensorConfig.cpp
+ * @brief Sensor settings that can be tuned at runtime and kept across reboots
+ */
+
+#include "SensorConfig.h"
+
+#include <Preferences.h>
+
+// NVS location of the stored configuration
+const char* const SENSOR_CONFIG_NAMESPACE = "sensors";
+const char* const SENSOR_CONFIG_KEY = "config";
+
+// Bump when SensorConfig changes layout; older blobs are then ignored
+const uint8_t SENSOR_CONFIG_VERSION = 1;
+
+/**
+ * @brief Layout of the stored blob
+ */
+struct StoredSensorConfig {
+    uint8_t version;
+    SensorConfig config;
+};
+
+// Output data rates the STHS34PF80 supports at 1 Hz and above
+const uint8_t SENSOR_ODRS_HZ[] = {1, 2, 4, 8, 15, 30};
+
+// Copy of what NVS holds, so unchanged saves don't touch the flash
+static StoredSensorConfig storedConfig = {};
+
+bool isSensorOdrSupported(uint8_t hz) {
+  for (uint8_t odr : SENSOR_ODRS_HZ) {
+    if (odr == hz) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool isValidSensorConfig(const SensorConfig& config) {
+  return config.thresholds.presence <= INT16_MAX && isSensorOdrSupported(config.odrHz);
+}
+
+uint8_t sensorConfigChanges(const SensorConfig& a, const SensorConfig& b) {
+  uint8_t changes = 0;
+  if (a.thresholds.presence != b.thresholds.presence || a.thresholds.motion != b.thresholds.motion ||
+      a.thresholds.hysteresis != b.thresholds.hysteresis) {
+    changes |= SENSOR_CONFIG_THRESHOLDS;
+  }
+  if (a.odrHz != b.odrHz) {
+    changes |= SENSOR_CONFIG_ODR;
+  }
+  if (a.presenceScale != b.presenceScale || a.motionScale != b.motionScale) {
+    changes |= SENSOR_CONFIG_SCALES;
+  }
+  return changes;
+}
+
+bool loadSensorConfig(SensorConfig& config) {
+  config = SENSOR_CONFIG_DEFAULT;
+
+  Preferences preferences;
+  if (!preferences.begin(SENSOR_CONFIG_NAMESPACE, true)) {
+    return false;
+  }
+  StoredSensorConfig stored = {};
+  size_t size = preferences.getBytes(SENSOR_CONFIG_KEY, &stored, sizeof(stored));
+  preferences.end();
+
+  if (size != sizeof(stored) || stored.version != SENSOR_CONFIG_VERSION || !isValidSensorConfig(stored.config)) {
+    return false;
+  }
+  storedConfig = stored;
+  config = stored.config;
+  return true;
+}
+
+bool saveSensorConfig(const SensorConfig& config) {
+  if (storedConfig.version == SENSOR_CONFIG_VERSION && sensorConfigChanges(storedConfig.config, config) == 0) {
+    return true;
+  }
+
+  StoredSensorConfig stored = {};
+  stored.version = SENSOR_CONFIG_VERSION;
+  stored.config = config;
+
+  Preferences preferences;
+  if (!preferences.begin(SENSOR_CONFIG_NAMESPACE, false)) {
+    return false;
+  }
+  bool written = preferences.putBytes(SENSOR_CONFIG_KEY, &stored, sizeof(stored)) == sizeof(stored);
+  preferences.end();
+
+  if (written) {
+    storedConfig = stored;
+  }
+  return written;
+}
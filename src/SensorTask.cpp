@@ -0,0 +1,365 @@
+/**
+ * @file SensorTask.cpp
+ * @brief Background sensor polling for the STHS34PF80 presence sensors
+ */
+
+#include "SensorTask.h"
+#include "SnapshotBuffer.h"
+#include "IntensityMap.h"
+#include "ChannelDetector.h"
+#include "FrameProfiler.h"
+
+#include <esp_timer.h>
+#include <atomic>
+
+// Minimum absolute value to consider as a valid reading (to filter noise)
+const uint16_t PRESENCE_MIN_VALUE = 70;        // Ignore presence values below this threshold
+const uint16_t MOTION_MIN_VALUE = 70;          // Increased from 40 to 70 to filter more baseline noise
+
+// Debounce settings to prevent flickering
+const uint8_t DEBOUNCE_COUNT = 3;              // Number of consecutive readings required to change state
+const uint16_t DEBOUNCE_THRESHOLD = 10;        // Threshold for considering a value stable
+const uint8_t INTENSITY_SMOOTHING_SHIFT = 2;   // Stable values are smoothed with weight 1/4
+
+// Task settings
+const uint32_t SENSOR_POLL_INTERVAL_MS = 10;   // Delay between data-ready checks when a sensor has no INT pin
+const uint32_t SENSOR_DRDY_TIMEOUT_MS = 100;   // Fall back to checking the flag if no edge arrives (3 samples at 30Hz)
+const uint32_t SENSOR_TASK_STACK_SIZE = 4096;  // Stack size in bytes
+const UBaseType_t SENSOR_TASK_PRIORITY = 2;    // Above the Arduino loop task
+const BaseType_t SENSOR_TASK_CORE = 0;         // Keep I2C off the render core
+
+// Raw value to intensity mappings, evaluated at compile time for the
+// default scale factors and rebuilt when the configuration changes them
+struct PresenceChannel;
+struct MotionChannel;
+using PresenceIntensityMap = TunableLogIntensityMap<PresenceChannel, PRESENCE_LOG_SCALE_FACTOR>;
+using MotionIntensityMap = TunableLogIntensityMap<MotionChannel, MOTION_LOG_SCALE_FACTOR>;
+
+// Per-channel debounce, stability check and smoothing
+using PresenceDetector = ChannelDetector<PresenceIntensityMap, PRESENCE_MIN_VALUE, DEBOUNCE_COUNT,
+                                         DEBOUNCE_THRESHOLD, INTENSITY_SMOOTHING_SHIFT>;
+using MotionDetector = ChannelDetector<MotionIntensityMap, MOTION_MIN_VALUE, DEBOUNCE_COUNT,
+                                       DEBOUNCE_THRESHOLD, INTENSITY_SMOOTHING_SHIFT>;
+
+// Latest debounced state, handed from the sensor task to the render loop
+static SnapshotBuffer<SensorSnapshot> sensorSnapshots;
+
+// Configuration requested by the render loop, applied by the sensor task
+static SnapshotBuffer<SensorConfig> configRequests;
+
+// Sensors owned by the task once started, and the configuration they have
+static SensorBus* taskBus = nullptr;
+static SensorConfigWriter configWriter = nullptr;
+static SensorConfig taskConfig;
+
+// Idle rate requested by the render loop (0: configured rate), and the task to
+// wake when the task leaves it on its own
+static std::atomic<uint8_t> idleOdrRequest(0);
+static std::atomic<TaskHandle_t> idleWakeTask(nullptr);
+
+// Idle rate the sensors are running at (sensor task only, 0: configured rate)
+static uint8_t idleOdrHz = 0;
+static TaskHandle_t sensorTaskHandle = nullptr;
+
+// Time the most recent sample became available, in microseconds
+static volatile uint32_t sampleTimeUs = 0;
+
+/**
+ * @brief Debounced state of one sensor (sensor task only)
+ */
+struct SensorChannels {
+  PresenceDetector presence;
+  MotionDetector motion;
+  SensorSample sample;
+};
+
+static SensorChannels sensorChannels[SensorBus::MAX_SENSORS];
+
+/**
+ * Read one sensor and update its debounced state
+ *
+ * @param index Sensor index on the bus
+ * @return true if a sample was read
+ */
+static bool pollSensor(uint8_t index) {
+  uint32_t readStart = profileCycles();
+  SensorChannels& channels = sensorChannels[index];
+  bool ok = taskBus->read(index, millis(), channels.sample);
+  profileRecord(PROFILE_SENSOR_I2C, profileCycles() - readStart);
+  if (!ok) {
+    return false;
+  }
+
+  ProfileScope processScope(PROFILE_SENSOR_PROCESS);
+  channels.presence.update(channels.sample.presenceFlag, channels.sample.presenceValue);
+  channels.motion.update(channels.sample.motionFlag, channels.sample.motionValue);
+  return true;
+}
+
+/**
+ * Combine every sensor into the published state
+ *
+ * Detection is the OR over sensors and each intensity the maximum; the raw
+ * values are those of the sensor with the strongest response.
+ *
+ * @param state Receives the combined state
+ */
+static void combineSensors(SensorSnapshot& state) {
+  state.presenceDetected = false;
+  state.motionDetected = false;
+  state.presenceIntensity = 0;
+  state.motionIntensity = 0;
+
+  uint8_t strongest = 0;
+  uint8_t strongestIntensity = 0;
+  for (uint8_t i = 0; i < taskBus->getSensorCount(); i++) {
+    const SensorChannels& channels = sensorChannels[i];
+    uint8_t presenceIntensity = channels.presence.getIntensity();
+    uint8_t motionIntensity = channels.motion.getIntensity();
+
+    state.presenceDetected |= channels.presence.isDetected();
+    state.motionDetected |= channels.motion.isDetected();
+    state.presenceIntensity = max(state.presenceIntensity, presenceIntensity);
+    state.motionIntensity = max(state.motionIntensity, motionIntensity);
+
+    uint8_t intensity = max(presenceIntensity, motionIntensity);
+    state.sensorIntensities[i] = intensity;
+    if (intensity > strongestIntensity) {
+      strongest = i;
+      strongestIntensity = intensity;
+    }
+  }
+
+  state.presenceValue = sensorChannels[strongest].sample.presenceValue;
+  state.motionValue = sensorChannels[strongest].sample.motionValue;
+  state.flagged = false;
+  for (uint8_t i = 0; i < taskBus->getSensorCount(); i++) {
+    const SensorSample& sample = sensorChannels[i].sample;
+    state.flagged |= sample.presenceFlag || sample.motionFlag;
+  }
+  state.busErrors = taskBus->getErrorCount();
+  state.sensorCount = taskBus->getSensorCount();
+}
+
+/**
+ * Data-ready interrupt: timestamp the sample and wake the sensor task
+ */
+static void IRAM_ATTR onSensorDataReady() {
+  sampleTimeUs = (uint32_t)esp_timer_get_time();
+
+  BaseType_t higherPriorityTaskWoken = pdFALSE;
+  vTaskNotifyGiveFromISR(sensorTaskHandle, &higherPriorityTaskWoken);
+  if (higherPriorityTaskWoken) {
+    portYIELD_FROM_ISR();
+  }
+}
+
+/**
+ * Whether every sensor has its INT pin wired
+ */
+static bool allSensorsInterruptDriven() {
+  for (uint8_t i = 0; i < taskBus->getSensorCount(); i++) {
+    if (taskBus->getPort(i).intPin < 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * Block until a sensor may have a new sample
+ *
+ * When every sensor's INT pin is wired this sleeps on the data-ready
+ * interrupt and the bus stays idle between samples. Otherwise (or if an
+ * edge was missed) it wakes every poll interval and the sensors without a
+ * pin are checked round-robin, one single-byte transaction each.
+ */
+static void waitForSamples() {
+  bool interruptDriven = allSensorsInterruptDriven();
+  uint32_t timeoutMs = interruptDriven ? SENSOR_DRDY_TIMEOUT_MS : SENSOR_POLL_INTERVAL_MS;
+  ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(timeoutMs));
+}
+
+/**
+ * Rebuild the intensity tables for the configured scale factors
+ */
+static void applyScales(const SensorConfig& config) {
+  PresenceIntensityMap::setScale(config.presenceScale);
+  MotionIntensityMap::setScale(config.motionScale);
+}
+
+/**
+ * Write part of a configuration to every sensor
+ *
+ * @param changes SENSOR_CONFIG_THRESHOLDS and/or SENSOR_CONFIG_ODR
+ */
+static void writeSensors(const SensorConfig& config, uint8_t changes) {
+  if (changes == 0) {
+    return;
+  }
+  for (uint8_t i = 0; i < taskBus->getSensorCount(); i++) {
+    if (taskBus->select(taskBus->getPort(i))) {
+      configWriter(i, config, changes);
+    }
+  }
+}
+
+/**
+ * Move the sensors to the requested idle or configured rate, if it changed
+ */
+static void applyIdleRequest() {
+  uint8_t requested = idleOdrRequest.load(std::memory_order_acquire);
+  if (requested == idleOdrHz || configWriter == nullptr || (requested != 0 && !isSensorOdrSupported(requested))) {
+    return;
+  }
+
+  SensorConfig config = taskConfig;
+  if (requested != 0) {
+    config.odrHz = requested;
+  }
+  writeSensors(config, SENSOR_CONFIG_ODR);
+  idleOdrHz = requested;
+}
+
+/**
+ * Leave the idle rate as soon as anything is flagged, and wake the render loop
+ */
+static void wakeFromIdle(const SensorSnapshot& state) {
+  if (idleOdrHz == 0 || !state.flagged) {
+    return;
+  }
+
+  idleOdrRequest.store(0, std::memory_order_release);
+  applyIdleRequest();
+
+  TaskHandle_t wakeTask = idleWakeTask.load(std::memory_order_acquire);
+  if (wakeTask != nullptr) {
+    xTaskNotifyGive(wakeTask);
+  }
+}
+
+/**
+ * Apply the latest requested configuration, if there is a new request
+ *
+ * Only what differs from the current configuration is written to the
+ * sensors, and the configuration is stored only if something differs.
+ */
+static void applyConfigRequest() {
+  SensorConfig config;
+  if (!configRequests.read(config) || configWriter == nullptr || !isValidSensorConfig(config)) {
+    return;
+  }
+  uint8_t changes = sensorConfigChanges(taskConfig, config);
+  if (changes == 0) {
+    return;
+  }
+
+  // A new configured rate takes effect when the sensors leave the idle rate
+  SensorConfig written = config;
+  if (idleOdrHz != 0) {
+    written.odrHz = idleOdrHz;
+    changes &= ~SENSOR_CONFIG_ODR;
+  }
+  writeSensors(written, changes & (SENSOR_CONFIG_THRESHOLDS | SENSOR_CONFIG_ODR));
+  if (changes & SENSOR_CONFIG_SCALES) {
+    applyScales(config);
+  }
+
+  taskConfig = config;
+  saveSensorConfig(config);
+}
+
+/**
+ * Sensor task body: wait for samples, debounce and publish forever
+ */
+static void sensorTask(void* /*parameter*/) {
+  SensorSnapshot state;
+
+  for (;;) {
+    waitForSamples();
+    applyConfigRequest();
+    applyIdleRequest();
+
+    // Read every sensor with a sample waiting; one failing sensor only
+    // costs its own (timed-out) transaction, then backs off
+    bool anyRead = false;
+    uint32_t nowMs = millis();
+    for (uint8_t i = 0; i < taskBus->getSensorCount(); i++) {
+      bool hasInterrupt = taskBus->getPort(i).intPin >= 0;
+      if (taskBus->isReady(i, nowMs) && pollSensor(i)) {
+        if (!hasInterrupt) {
+          sampleTimeUs = micros();
+        }
+        anyRead = true;
+      }
+    }
+    if (!anyRead) {
+      continue;
+    }
+
+    combineSensors(state);
+    state.sampleTimeUs = sampleTimeUs;
+    state.sequence++;
+    state.idle = idleOdrHz != 0 && !state.flagged;
+    sensorSnapshots.publish(state);
+
+    wakeFromIdle(state);
+  }
+}
+
+bool startSensorTask(SensorBus& bus, const SensorConfig& config, SensorConfigWriter writeConfig) {
+  if (bus.getSensorCount() == 0) {
+    return false;
+  }
+  taskBus = &bus;
+  configWriter = writeConfig;
+  taskConfig = config;
+  applyScales(config);
+
+  BaseType_t result = xTaskCreatePinnedToCore(
+    sensorTask,
+    "sensor",
+    SENSOR_TASK_STACK_SIZE,
+    nullptr,
+    SENSOR_TASK_PRIORITY,
+    &sensorTaskHandle,
+    SENSOR_TASK_CORE);
+
+  if (result != pdPASS) {
+    return false;
+  }
+
+  // Sensors drive INT high while a sample is waiting (latched mode)
+  for (uint8_t i = 0; i < bus.getSensorCount(); i++) {
+    int8_t intPin = bus.getPort(i).intPin;
+    if (intPin >= 0) {
+      pinMode(intPin, INPUT);
+      attachInterrupt(digitalPinToInterrupt(intPin), onSensorDataReady, RISING);
+    }
+  }
+
+  return true;
+}
+
+bool readSensorSnapshot(SensorSnapshot& out) {
+  return sensorSnapshots.read(out);
+}
+
+void requestSensorIdle(uint8_t odrHz) {
+  idleWakeTask.store(xTaskGetCurrentTaskHandle(), std::memory_order_relaxed);
+  idleOdrRequest.store(odrHz, std::memory_order_release);
+  pollSensorsNow();
+}
+
+void pollSensorsNow() {
+  if (sensorTaskHandle != nullptr) {
+    xTaskNotifyGive(sensorTaskHandle);
+  }
+}
+
+void requestSensorConfig(const SensorConfig& config) {
+  configRequests.publish(config);
+  if (sensorTaskHandle != nullptr) {
+    xTaskNotifyGive(sensorTaskHandle);
+  }
+}
@@ -0,0 +1,126 @@
+/**
+ * @file Telemetry.cpp
+ * @brief Compact binary telemetry over the serial port
+ */
+
+#include "Telemetry.h"
+#include "RingBuffer.h"
+
+// Task settings
+const uint16_t TELEMETRY_BUFFER_RECORDS = 32;     // About one second of sensor samples at 30Hz
+const uint32_t TELEMETRY_TASK_STACK_SIZE = 4096;  // Stack size in bytes
+const UBaseType_t TELEMETRY_TASK_PRIORITY = 1;    // Below the sensor task
+const BaseType_t TELEMETRY_TASK_CORE = 0;         // Keep serial output off the render core
+
+// Record plus CRC-16, COBS-encoded (one overhead byte per 254), plus both delimiters
+const size_t TELEMETRY_PAYLOAD_SIZE = sizeof(TelemetryRecord) + 2;
+const size_t TELEMETRY_FRAME_SIZE = TELEMETRY_PAYLOAD_SIZE + TELEMETRY_PAYLOAD_SIZE / 254 + 1 + 2;
+
+// Records waiting for the telemetry task
+static RingBuffer<TelemetryRecord, TELEMETRY_BUFFER_RECORDS> telemetryBuffer;
+
+static TaskHandle_t telemetryTaskHandle = nullptr;
+
+// Records dropped because the buffer was full (written by the producer only)
+static std::atomic<uint32_t> droppedRecords(0);
+
+/**
+ * CRC-16/CCITT-FALSE (polynomial 0x1021, initial value 0xFFFF)
+ */
+static uint16_t crc16(const uint8_t* data, size_t length) {
+  uint16_t crc = 0xFFFF;
+  for (size_t i = 0; i < length; i++) {
+    crc ^= (uint16_t)data[i] << 8;
+    for (uint8_t bit = 0; bit < 8; bit++) {
+      crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+    }
+  }
+  return crc;
+}
+
+/**
+ * COBS-encode a block so it contains no zero bytes
+ *
+ * @param in Data to encode
+ * @param length Length of the data
+ * @param out Receives the encoded data (length + length / 254 + 1 bytes)
+ * @return Length of the encoded data
+ */
+static size_t cobsEncode(const uint8_t* in, size_t length, uint8_t* out) {
+  size_t codeIndex = 0;
+  size_t outIndex = 1;
+  uint8_t code = 1;
+
+  for (size_t i = 0; i < length; i++) {
+    if (in[i] != 0) {
+      out[outIndex++] = in[i];
+      code++;
+    }
+    if (in[i] == 0 || code == 0xFF) {
+      out[codeIndex] = code;
+      codeIndex = outIndex++;
+      code = 1;
+    }
+  }
+
+  out[codeIndex] = code;
+  return outIndex;
+}
+
+/**
+ * Telemetry task body: frame and write every queued record
+ */
+static void telemetryTask(void* /*parameter*/) {
+  TelemetryRecord record;
+  uint8_t payload[TELEMETRY_PAYLOAD_SIZE];
+  uint8_t frame[TELEMETRY_FRAME_SIZE];
+
+  for (;;) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+    while (telemetryBuffer.pop(record)) {
+      record.droppedRecords = min(droppedRecords.load(std::memory_order_relaxed), (uint32_t)UINT16_MAX);
+
+      memcpy(payload, &record, sizeof(record));
+      uint16_t crc = crc16(payload, sizeof(record));
+      payload[sizeof(record)] = crc & 0xFF;
+      payload[sizeof(record) + 1] = crc >> 8;
+
+      // Delimit both ends so text printed in between can't merge into a frame
+      size_t length = 0;
+      frame[length++] = 0;
+      length += cobsEncode(payload, sizeof(payload), frame + length);
+      frame[length++] = 0;
+
+      // One write per frame, so other tasks' prints can't split it
+      Serial.write(frame, length);
+    }
+  }
+}
+
+bool startTelemetryTask() {
+  BaseType_t result = xTaskCreatePinnedToCore(
+    telemetryTask,
+    "telemetry",
+    TELEMETRY_TASK_STACK_SIZE,
+    nullptr,
+    TELEMETRY_TASK_PRIORITY,
+    &telemetryTaskHandle,
+    TELEMETRY_TASK_CORE);
+
+  return result == pdPASS;
+}
+
+bool sendTelemetry(const TelemetryRecord& record) {
+  if (telemetryTaskHandle == nullptr) {
+    return false;
+  }
+
+  if (!telemetryBuffer.push(record)) {
+    droppedRecords.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+
+  xTaskNotifyGive(telemetryTaskHandle);
+  return true;
+}
@@ -3,26 +3,75 @@
 #include <FastLED.h>
 #include <SparkFun_STHS34PF80_Arduino_Library.h> // Include the official SparkFun library
 #include <LEDPatterns.h> // Include from library directory using angle brackets
+#include "SensorBus.h"
+#include "SensorConfig.h"
+#include "SensorTask.h"
+#include "FrameScheduler.h"
+#include "OutputStage.h"
+#include "PowerMode.h"
+#include "FrameProfiler.h"
+#include "Telemetry.h"
+#include "ColorSchemes.h"
+
+// Sweep every pattern at boot before running normally (env:benchmark)
+#ifndef BENCHMARK_MODE
+#define BENCHMARK_MODE 0
+#endif
+
+#if BENCHMARK_MODE
+#include "Benchmark.h"
+#endif
+#ifdef WIFI_SSID
+#include "NetworkControl.h"
+#endif
 
 // Pin Definitions are defined in platformio.ini as build flags:
-// LED_PIN, LED_COUNT, I2C_SDA, I2C_SCL
+// LED_PIN, LED_COUNT, TARGET_FPS, I2C_SDA, I2C_SCL, SENSOR_INT_PIN (optional)
+// A second sensor on Wire1: I2C1_SDA, I2C1_SCL, SENSOR1_INT_PIN (optional)
+// Sensors behind a TCA9548A on Wire instead: SENSOR_MUX_CHANNELS
+// Remote control and streaming: WIFI_SSID, WIFI_PASSWORD
+// Optional pins default to -1 (not connected)
+
+#ifndef SENSOR_INT_PIN
+#define SENSOR_INT_PIN -1
+#endif
+
+#ifndef I2C1_SDA
+#define I2C1_SDA -1
+#endif
+
+#ifndef SENSOR1_INT_PIN
+#define SENSOR1_INT_PIN -1
+#endif
+
+// Number of TCA9548A channels with a sensor (0 without a mux)
+#ifndef SENSOR_MUX_CHANNELS
+#define SENSOR_MUX_CHANNELS 0
+#endif
 
-// Sensor scaling constants
-const uint8_t PRESENCE_LOG_SCALE_FACTOR = 60;  // Multiplier for log-scaled presence values
-const uint8_t MOTION_LOG_SCALE_FACTOR = 70;    // Multiplier for log-scaled motion values
+#ifndef TARGET_FPS
+#define TARGET_FPS 60
+#endif
 
-// Detection threshold constants
-const uint16_t PRESENCE_THRESHOLD_DEFAULT = 100;  // Default threshold for presence detection
-const uint8_t MOTION_THRESHOLD_DEFAULT = 50;     // Default threshold for motion detection
-const uint8_t HYSTERESIS_DEFAULT = 25;          // Default hysteresis value
+// 400 kHz by default; the STHS34PF80 also supports 1 MHz on short wiring
+#ifndef I2C_CLOCK_HZ
+#define I2C_CLOCK_HZ 400000
+#endif
 
-// Minimum absolute value to consider as a valid reading (to filter noise)
-const uint16_t PRESENCE_MIN_VALUE = 70;        // Ignore presence values below this threshold
-const uint16_t MOTION_MIN_VALUE = 70;          // Increased from 40 to 70 to filter more baseline noise
+// Skip the serial test and the boot delays, so the LEDs react as soon as
+// possible after power-up (text printed before the monitor attaches is lost)
+#ifndef FAST_BOOT
+#define FAST_BOOT 0
+#endif
 
-// Debounce settings to prevent flickering
-const uint8_t DEBOUNCE_COUNT = 3;              // Number of consecutive readings required to change state
-const uint16_t DEBOUNCE_THRESHOLD = 10;        // Threshold for considering a value stable
+// Sparkles added over the breathing, pulse, chase and field patterns while
+// motion is detected, so movement shows at any intensity
+#ifndef MOTION_SPARKLES
+#define MOTION_SPARKLES 0
+#endif
+
+// A transaction to an unplugged or stuck sensor gives up after this long
+const uint16_t I2C_TIMEOUT_MS = 5;
 
 // LED pattern intensity thresholds
 const uint8_t INTENSITY_LOW = 64;     // Threshold for low intensity effects (breathing)
@@ -30,42 +79,75 @@ const uint8_t INTENSITY_MEDIUM = 128; // Threshold for medium intensity effects
 const uint8_t INTENSITY_HIGH = 192;   // Threshold for high intensity effects (chase/fire/twinkle)
 const uint8_t INTENSITY_MAX = 255;    // Maximum intensity value
 
-// Color range constants
-const uint8_t HUE_HIGH = 0;    // Red (for high intensity)
-const uint8_t HUE_LOW = 160;   // Blue (for low intensity)
+// LED brightness (0-255); frames that would exceed LED_POWER_BUDGET_MA are dimmed
+const uint8_t LED_BRIGHTNESS = 128;
+
+// Cross-fade time when the intensity selects a different pattern
+const uint16_t PATTERN_TRANSITION_MS = 400;
+
+// Strength of the motion sparkles added over the pattern (MOTION_SPARKLES builds)
+const uint8_t MOTION_SPARKLE_OPACITY = 160;
+
+// Frame statistics are printed at most this often, and only after an overrun
+const uint32_t FRAME_REPORT_INTERVAL_MS = 10000;
+
+// Stage timing histograms are printed this often (FRAME_PROFILING builds)
+const uint32_t PROFILE_REPORT_INTERVAL_MS = 10000;
 
-// LED Array
+// With several sensors, each lights the strip around its own position. The
+// default spreads them evenly; override with e.g. -D 'SENSOR_POSITIONS={20,75,130}'
+// (LED indices in the order the sensors are found)
+#ifdef SENSOR_POSITIONS
+const uint16_t SENSOR_LED_POSITIONS[] = SENSOR_POSITIONS;
+#endif
+const uint8_t FIELD_BACKGROUND_LEVEL = 24;  // Brightness between sensors that see someone
+
+static_assert(SensorBus::MAX_SENSORS <= LEDPATTERNS_FIELD_SOURCES, "Every sensor needs a field source");
+
+// LED Array (render buffer; the output stage owns the buffer FastLED transmits)
 CRGB leds[LED_COUNT];
 
 // Create instances
-STHS34PF80_I2C presenceSensor; // Using the correct class name from the official SparkFun library
-LEDPatterns ledPatterns(leds, LED_COUNT);
-
-// Sensor Variables
-bool presenceDetected = false;
-bool motionDetected = false;
-uint8_t motionIntensity = 0;
-uint8_t presenceIntensity = 0;
-int16_t presenceValue = 0;
-int16_t motionValue = 0;
-
-// Debouncing variables
-uint8_t presenceDetectionCount = 0;
-uint8_t presenceNonDetectionCount = 0;
-uint8_t motionDetectionCount = 0;
-uint8_t motionNonDetectionCount = 0;
-int16_t lastPresenceValue = 0;
-int16_t lastMotionValue = 0;
-
-// Store threshold values locally since there are no getter methods
-// Actually, there are getter methods, but we'll keep these variables for easy access
-uint16_t presenceThreshold = PRESENCE_THRESHOLD_DEFAULT;
-uint8_t motionThreshold = MOTION_THRESHOLD_DEFAULT;
-uint8_t hysteresis = HYSTERESIS_DEFAULT;
+STHS34PF80_I2C presenceSensors[SensorBus::MAX_SENSORS]; // Using the correct class name from the official SparkFun library
+SensorBus sensorBus;
+FixedLEDPatterns<LED_COUNT> ledPatterns(leds);
+FrameScheduler frameScheduler(TARGET_FPS);
+OutputStage outputStage(leds);
+PowerMode powerMode(frameScheduler, outputStage);
+ColorScheme colorScheme;
+
+#if MOTION_SPARKLES
+// Pattern of the sparkle layer, and its index in ledPatterns (-1 without one)
+TwinklePattern sparklePattern;
+int8_t sparkleLayer = -1;
+#endif
+
+// Latest sensor state received from the sensor task
+SensorSnapshot sensorState;
+
+// Configuration last written to the sensors (loaded from NVS at boot)
+SensorConfig sensorConfig = SENSOR_CONFIG_DEFAULT;
+
+// Configured output brightness
+uint8_t ledBrightness = LED_BRIGHTNESS;
+
+#ifdef WIFI_SSID
+// Settings last received over the network
+RemoteSettings remoteSettings;
+
+// Whether the last frame came from a network stream
+bool streaming = false;
+#endif
 
 // Pattern selection
 PatternType currentPattern = PATTERN_BREATHING;
 
+// Frame statistics reporting
+uint32_t lastFrameReportMs = 0;
+uint32_t reportedOverruns = 0;
+uint32_t lastProfileReportMs = 0;
+uint32_t reportedBusErrors = 0;
+
 /**
  * Test Serial connection with a simple sequence of characters
  */
@@ -87,19 +169,328 @@ void testSerial() {
  */
 void initI2C() {
   Wire.begin(I2C_SDA, I2C_SCL);
-  Wire.setClock(100000); // Set I2C clock to 100kHz
-  Serial.println("I2C initialized");
+  Wire.setClock(I2C_CLOCK_HZ);
+  Wire.setTimeOut(I2C_TIMEOUT_MS);
+#if I2C1_SDA >= 0
+  Wire1.begin(I2C1_SDA, I2C1_SCL);
+  Wire1.setClock(I2C_CLOCK_HZ);
+  Wire1.setTimeOut(I2C_TIMEOUT_MS);
+#endif
+  Serial.print("I2C initialized at ");
+  Serial.print(I2C_CLOCK_HZ / 1000);
+  Serial.println(" kHz");
+}
+
+/**
+ * List the places a sensor may be connected, from the build flags
+ *
+ * The STHS34PF80 address is fixed, so each sensor is on its own bus or its
+ * own mux channel.
+ *
+ * @param ports Receives up to SensorBus::MAX_SENSORS + 1 ports
+ * @return Number of ports
+ */
+uint8_t listSensorPorts(SensorPort* ports) {
+  uint8_t count = 0;
+  
+#if SENSOR_MUX_CHANNELS > 0
+  // One sensor per TCA9548A channel on Wire; these are polled
+  for (int8_t channel = 0; channel < SENSOR_MUX_CHANNELS && count < SensorBus::MAX_SENSORS; channel++) {
+    ports[count].wire = &Wire;
+    ports[count].muxChannel = channel;
+    count++;
+  }
+#else
+  ports[count].wire = &Wire;
+  ports[count].intPin = SENSOR_INT_PIN;
+  count++;
+#endif
+  
+#if I2C1_SDA >= 0
+  ports[count].wire = &Wire1;
+  ports[count].intPin = SENSOR1_INT_PIN;
+  count++;
+#endif
+  
+  return count;
+}
+
+/**
+ * Write thresholds and hysteresis to a sensor in power-down mode
+ *
+ * @param sensor Sensor, already begun
+ * @param thresholds Thresholds to write
+ */
+void writeSensorThresholds(STHS34PF80_I2C& sensor, const SensorThresholds& thresholds) {
+  // Enable access to embedded functions registers
+  sensor.setMemoryBank(STHS34PF80_EMBED_FUNC_MEM_BANK);
+  
+  // Set thresholds and hysteresis
+  sensor.setPresenceThreshold(thresholds.presence);
+  sensor.setMotionThreshold(thresholds.motion);
+  sensor.setPresenceHysteresis(thresholds.hysteresis);
+  sensor.setMotionHysteresis(thresholds.hysteresis);
+  
+  // Disable access to embedded functions registers
+  sensor.setMemoryBank(STHS34PF80_MAIN_MEM_BANK);
+}
+
+/**
+ * Library setting for an output data rate
+ *
+ * @param hz Rate supported by the sensor (isSensorOdrSupported())
+ */
+sths34pf80_tmos_odr_t sensorOdr(uint8_t hz) {
+  switch (hz) {
+    case 1: return STHS34PF80_TMOS_ODR_AT_1Hz;
+    case 2: return STHS34PF80_TMOS_ODR_AT_2Hz;
+    case 4: return STHS34PF80_TMOS_ODR_AT_4Hz;
+    case 8: return STHS34PF80_TMOS_ODR_AT_8Hz;
+    case 15: return STHS34PF80_TMOS_ODR_AT_15Hz;
+    default: return STHS34PF80_TMOS_ODR_AT_30Hz;
+  }
+}
+
+/**
+ * Write a changed configuration to a running sensor (called from the sensor task)
+ *
+ * @param index Sensor index on the bus, already selected
+ * @param config New configuration
+ * @param changes What to write (SENSOR_CONFIG_THRESHOLDS, SENSOR_CONFIG_ODR)
+ */
+void updateSensorConfig(uint8_t index, const SensorConfig& config, uint8_t changes) {
+  STHS34PF80_I2C& sensor = presenceSensors[index];
+  
+  // The embedded function registers may only be written in power-down mode
+  if (changes & SENSOR_CONFIG_THRESHOLDS) {
+    sensor.setTmosODR(STHS34PF80_TMOS_ODR_OFF);
+    writeSensorThresholds(sensor, config.thresholds);
+  }
+  sensor.setTmosODR(sensorOdr(config.odrHz));
+}
+
+/**
+ * Configure one sensor's thresholds, DRDY routing and output data rate
+ *
+ * @param sensor Sensor, already begun
+ * @param port Where it is connected
+ */
+void configureSensor(STHS34PF80_I2C& sensor, const SensorPort& port) {
+  // Configure the sensor based on the official examples
+  // Enter power-down mode by setting ODR to 0
+  sensor.setTmosODR(STHS34PF80_TMOS_ODR_OFF);
+  
+  writeSensorThresholds(sensor, sensorConfig.thresholds);
+  
+  if (port.intPin >= 0) {
+    // Route data-ready to the INT pin, held high until the sample is read
+    sensor.setTmosRouteInterrupt(STHS34PF80_TMOS_INT_DRDY);
+    sensor.setDataReadyMode(STHS34PF80_DRDY_LATCHED);
+  }
+  
+  // Enter continuous mode (30Hz by default, the highest rate, for maximum responsiveness)
+  sensor.setTmosODR(sensorOdr(sensorConfig.odrHz));
+}
+
+/**
+ * Find, configure and add every connected sensor to the bus
+ *
+ * @return Number of sensors found
+ */
+uint8_t initSensors() {
+  SensorPort ports[SensorBus::MAX_SENSORS + 1];
+  uint8_t numPorts = listSensorPorts(ports);
+  
+  for (uint8_t i = 0; i < numPorts && sensorBus.getSensorCount() < SensorBus::MAX_SENSORS; i++) {
+    STHS34PF80_I2C& sensor = presenceSensors[sensorBus.getSensorCount()];
+    
+    // Initialize sensor using the SparkFun library
+    if (!sensorBus.select(ports[i]) || !sensor.begin(STHS34PF80_I2C_ADDRESS, *ports[i].wire)) {
+      Serial.print("No presence sensor on port ");
+      Serial.println(i);
+      continue;
+    }
+    
+    configureSensor(sensor, ports[i]);
+    sensorBus.addSensor(ports[i]);
+    Serial.print("Presence sensor initialized on port ");
+    Serial.println(i);
+  }
+  
+  return sensorBus.getSensorCount();
+}
+
+/**
+ * Place one field source per sensor along the strip
+ */
+void initField() {
+  uint8_t count = sensorBus.getSensorCount();
+  if (count == 0) {
+    return;
+  }
+  
+  uint16_t positions[SensorBus::MAX_SENSORS];
+  for (uint8_t i = 0; i < count; i++) {
+    // Centre of the i-th of count equal stretches of strip
+    positions[i] = (uint32_t)LED_COUNT * (2 * i + 1) / (2 * count);
+#ifdef SENSOR_POSITIONS
+    if (i < sizeof(SENSOR_LED_POSITIONS) / sizeof(SENSOR_LED_POSITIONS[0])) {
+      positions[i] = SENSOR_LED_POSITIONS[i];
+    }
+#endif
+  }
+  
+  // A third of the spacing: neighbouring sensors blend, distant ones don't
+  ledPatterns.setFieldSources(positions, count, max(LED_COUNT / (3 * count), 1));
 }
 
 /**
  * Initialize the LED strip
  */
 void initLEDs() {
-  FastLED.addLeds<WS2812B, LED_PIN, GRB>(leds, LED_COUNT);
-  FastLED.setBrightness(50); // 0-255
-  FastLED.clear();
-  FastLED.show();
-  Serial.println("LEDs initialized");
+  if (!outputStage.begin()) {
+    Serial.println("Failed to start LED output task");
+  }
+  outputStage.setBrightness(ledBrightness);
+  fill_solid(leds, LED_COUNT, CRGB::Black);
+  outputStage.present();
+  
+  colorScheme.select(COLOR_SCHEME, FIELD_BACKGROUND_LEVEL);
+  Serial.print("LEDs initialized, color scheme ");
+  Serial.println(colorSchemeName(colorScheme.getId()));
+}
+
+/**
+ * Print frame timing statistics if frames have overrun since the last report
+ */
+void reportFrameStats() {
+  uint32_t ms = millis();
+  if (ms - lastFrameReportMs < FRAME_REPORT_INTERVAL_MS) {
+    return;
+  }
+  lastFrameReportMs = ms;
+  
+  uint32_t overruns = frameScheduler.getOverrunCount();
+  if (overruns == reportedOverruns) {
+    return;
+  }
+  
+  Serial.print("Frames: target ");
+  Serial.print(frameScheduler.getTargetFps());
+  Serial.print(" FPS, overruns ");
+  Serial.print(overruns - reportedOverruns);
+  Serial.print(" (total ");
+  Serial.print(overruns);
+  Serial.print("), last work ");
+  Serial.print(frameScheduler.getLastFrameWorkUs());
+  Serial.print(" us, worst overrun ");
+  Serial.print(frameScheduler.getWorstOverrunUs());
+  Serial.println(" us");
+  
+  reportedOverruns = overruns;
+}
+
+/**
+ * Report a new sensor sample
+ *
+ * With SERIAL_TELEMETRY this queues a binary record for the telemetry task,
+ * which never blocks the loop. Otherwise detections are printed as text.
+ *
+ * @param intensity Combined intensity driving the pattern
+ */
+void reportSensorSample(uint8_t intensity) {
+#if SERIAL_TELEMETRY
+  TelemetryRecord record = {};
+  record.type = TELEMETRY_RECORD_SENSOR;
+  record.flags = (sensorState.presenceDetected ? TELEMETRY_FLAG_PRESENCE : 0) |
+                 (sensorState.motionDetected ? TELEMETRY_FLAG_MOTION : 0) |
+                 (outputStage.getAppliedBrightness() < ledBrightness ? TELEMETRY_FLAG_POWER_LIMITED : 0) |
+                 (powerMode.isIdle() ? TELEMETRY_FLAG_IDLE : 0) |
+                 (sensorState.idle ? TELEMETRY_FLAG_SENSOR_IDLE : 0);
+  record.sampleTimeUs = sensorState.sampleTimeUs;
+  record.sampleSequence = sensorState.sequence;
+  record.presenceValue = sensorState.presenceValue;
+  record.motionValue = sensorState.motionValue;
+  record.presenceIntensity = sensorState.presenceIntensity;
+  record.motionIntensity = sensorState.motionIntensity;
+  record.combinedIntensity = intensity;
+  record.pattern = currentPattern;
+  record.frameStartUs = frameScheduler.getFrameStartUs();
+  record.frameWorkUs = min(frameScheduler.getLastFrameWorkUs(), (uint32_t)UINT16_MAX);
+  record.showUs = min(outputStage.getLastShowUs(), (uint32_t)UINT16_MAX);
+  record.estimatedMa = min(outputStage.getEstimatedMa(), (uint32_t)UINT16_MAX);
+  record.brightness = outputStage.getAppliedBrightness();
+  record.overrunCount = frameScheduler.getOverrunCount();
+  sendTelemetry(record);
+#else
+  // Only print when the reading reports a detection (prevents serial flooding)
+  if (sensorState.presenceDetected || sensorState.motionDetected) {
+    Serial.print("Sensor: ");
+    if (sensorState.presenceDetected) Serial.print("Presence ");
+    if (sensorState.motionDetected) Serial.print("Motion ");
+    Serial.print("- Presence Value: ");
+    Serial.print(sensorState.presenceValue);
+    Serial.print(", Motion Value: ");
+    Serial.print(sensorState.motionValue);
+    Serial.print(", Combined Intensity: ");
+    Serial.println(intensity);
+  }
+  
+  if (sensorState.busErrors != reportedBusErrors) {
+    reportedBusErrors = sensorState.busErrors;
+    Serial.print("Sensor I2C errors: ");
+    Serial.println(reportedBusErrors);
+  }
+#endif
+}
+
+/**
+ * Print the stage timing histograms periodically
+ */
+void reportProfile() {
+#if FRAME_PROFILING
+  uint32_t ms = millis();
+  if (ms - lastProfileReportMs < PROFILE_REPORT_INTERVAL_MS) {
+    return;
+  }
+  lastProfileReportMs = ms;
+  
+  reportFrameProfile(Serial);
+#endif
+}
+
+/**
+ * Show or hide the sparkles added over the pattern for this frame
+ *
+ * @param motion Whether motion is detected
+ * @param intensity Combined intensity (0-255)
+ */
+void updateSparkleLayer(bool motion, uint8_t intensity) {
+#if MOTION_SPARKLES
+  if (sparkleLayer < 0) {
+    return;
+  }
+  
+  // Fire and twinkle sparkle already, and a forced pattern is shown as it is
+  bool shown = motion && currentPattern != PATTERN_FIRE && currentPattern != PATTERN_TWINKLE;
+#ifdef WIFI_SSID
+  shown = shown && remoteSettings.pattern == NUM_PATTERNS;
+#endif
+  if (!shown) {
+    ledPatterns.hideLayer(sparkleLayer);
+    return;
+  }
+  
+  // Paler than the pattern below, and more of them as the intensity rises
+  const CHSV& schemeColor = colorScheme.colorAt(intensity);
+  PatternParams params;
+  params.color = CHSV(schemeColor.h, schemeColor.s / 2, 255);
+  params.chance = map(min(intensity, INTENSITY_HIGH), 0, INTENSITY_HIGH, 3, 15);
+  ledPatterns.setLayer(sparkleLayer, params, BLEND_ADD, MOTION_SPARKLE_OPACITY);
+#else
+  (void)motion;
+  (void)intensity;
+#endif
 }
 
 /**
@@ -110,211 +501,307 @@ void initLEDs() {
  * @param intensity Overall intensity value (0-255)
  */
 void updateLEDPattern(bool presence, bool motion, uint8_t intensity) {
-  // Calculate hue based on intensity (blue when low, red when high)
-  uint8_t hue = map(intensity, 0, INTENSITY_MAX, HUE_LOW, HUE_HIGH);
+  // Color from the installation's scheme (by default blue when low, red when high)
+  const CHSV& schemeColor = colorScheme.colorAt(intensity);
+  
+  PatternParams params;
+  params.color = schemeColor;
   
-  if (presence || motion) {
+  if ((presence || motion) && sensorState.sensorCount > 1) {
+    // Several sensors - light and color the strip around each one by its
+    // own intensity
+    currentPattern = PATTERN_FIELD;
+    params.palette = &colorScheme.getFieldPalette();
+    params.levels = sensorState.sensorIntensities;
+  }
+  else if (presence || motion) {
     // Presence or motion detected - select pattern based on intensity
     if (intensity < INTENSITY_LOW) {
       // Low intensity - breathing effect
-      ledPatterns.breathing(CHSV(hue, 255, 255), map(intensity, 0, INTENSITY_LOW, 5, 15));
+      currentPattern = PATTERN_BREATHING;
+      params.speed = map(intensity, 0, INTENSITY_LOW, 5, 15);
     } 
     else if (intensity < INTENSITY_MEDIUM) {
       // Medium-low intensity - pulse effect
-      ledPatterns.pulse(CHSV(hue, 255, 255), map(intensity, INTENSITY_LOW, INTENSITY_MEDIUM, 5, 20));
+      currentPattern = PATTERN_PULSE;
+      params.speed = map(intensity, INTENSITY_LOW, INTENSITY_MEDIUM, 5, 20);
     }
     else if (intensity < INTENSITY_HIGH) {
       // Medium-high intensity - chase effect
-      ledPatterns.chase(CHSV(hue, 255, 255), CHSV(hue, 128, 64), 3, map(intensity, INTENSITY_MEDIUM, INTENSITY_HIGH, 10, 40));
+      currentPattern = PATTERN_CHASE;
+      params.secondaryColor = CHSV(schemeColor.h, schemeColor.s / 2, 64);
+      params.size = 3;
+      params.speed = map(intensity, INTENSITY_MEDIUM, INTENSITY_HIGH, 10, 40);
     }
     else {
       // High intensity - fire effect (if motion) or twinkle effect (if presence only)
       if (motion) {
         // Modified parameters for fire effect to prevent white output at high intensity
-        // First parameter: cooling (lower = more heat)
-        // Second parameter: sparking (higher = more sparks)
-        ledPatterns.fire(map(intensity, INTENSITY_HIGH, INTENSITY_MAX, 100, 50), map(intensity, INTENSITY_HIGH, INTENSITY_MAX, 50, 120));
+        // cooling: lower = more heat
+        // sparking: higher = more sparks
+        currentPattern = PATTERN_FIRE;
+        params.cooling = map(intensity, INTENSITY_HIGH, INTENSITY_MAX, 100, 50);
+        params.sparking = map(intensity, INTENSITY_HIGH, INTENSITY_MAX, 50, 120);
       } else {
-        ledPatterns.twinkle(CHSV(hue, 255, 255), map(intensity, INTENSITY_HIGH, INTENSITY_MAX, 10, 40));
+        currentPattern = PATTERN_TWINKLE;
+        params.chance = map(intensity, INTENSITY_HIGH, INTENSITY_MAX, 10, 40);
       }
     }
   } 
   else {
-    // No presence or motion - gentle breathing effect in blue
-    ledPatterns.breathing(CHSV(HUE_LOW, 255, 128), 5);
+    // No presence or motion - gentle breathing effect in the scheme's idle color
+    const CHSV& idleColor = colorScheme.colorAt(0);
+    currentPattern = PATTERN_BREATHING;
+    params.color = CHSV(idleColor.h, idleColor.s, 128);
+    params.speed = 5;
+  }
+  
+#ifdef WIFI_SSID
+  // A pattern forced over the network replaces the sensor-driven choice
+  if (remoteSettings.pattern != NUM_PATTERNS) {
+    currentPattern = remoteSettings.pattern;
+    params = PatternParams();
+    params.color = CHSV(remoteSettings.hue, 255, 255);
+    params.speed = remoteSettings.speed;
+    params.palette = &colorScheme.getFieldPalette();
+    params.levels = sensorState.sensorIntensities;
+  }
+#endif
+  
+  updateSparkleLayer(motion, intensity);
+  
+  // Each pattern keeps its own state, so switching doesn't reset the others.
+  // Everything animates to the frame's scheduled start, not to whenever
+  // rendering happens to run, so motion stays even when a frame runs late.
+  uint32_t renderStart = profileCycles();
+  bool changed = ledPatterns.render(currentPattern, params, frameScheduler.getFrameStartUs());
+  uint32_t renderCycles = profileCycles() - renderStart;
+  profileRecord(PROFILE_RENDER, renderCycles);
+  profileRecordPattern(currentPattern, renderCycles);
+  
+  // Hand the frame to the output task; it transmits while the next frame
+  // renders. Unchanged frames aren't transmitted again.
+  ProfileScope presentScope(PROFILE_PRESENT);
+  outputStage.present(changed);
+}
+
+/**
+ * Apply settings changed over the network since the last frame
+ */
+void applyRemoteSettings() {
+#ifdef WIFI_SSID
+  RemoteSettings settings;
+  if (!readRemoteSettings(settings)) {
+    return;
+  }
+  
+  if (settings.brightness != ledBrightness) {
+    ledBrightness = settings.brightness;
+    outputStage.setBrightness(ledBrightness);
+  }
+  if (settings.transitionMs != remoteSettings.transitionMs) {
+    ledPatterns.setTransitionTime(settings.transitionMs);
+  }
+  
+  // The sensor task applies and stores it before its next read
+  if (sensorConfigChanges(settings.sensor, sensorConfig) != 0) {
+    sensorConfig = settings.sensor;
+    requestSensorConfig(sensorConfig);
+  }
+  
+  remoteSettings = settings;
+#endif
+}
+
+/**
+ * Present the latest frame streamed over the network, if a stream is running
+ *
+ * The frame goes to the output stage straight from the buffer it was
+ * received into; the render buffer and the patterns are left alone.
+ *
+ * @return true if the stream supplied this frame
+ */
+bool presentStreamFrame() {
+#ifdef WIFI_SSID
+  bool fresh;
+  const CRGB* frame = acquireStreamFrame(fresh);
+  if (frame == nullptr) {
+    // The render buffer may equal the frame before the stream started
+    if (streaming) {
+      streaming = false;
+      outputStage.invalidate();
+    }
+    return false;
   }
   
-  FastLED.show();
+  streaming = true;
+  ProfileScope presentScope(PROFILE_PRESENT);
+  outputStage.present(frame, fresh);
+  return true;
+#else
+  return false;
+#endif
+}
+
+/**
+ * Go idle while nothing is happening, and back to full speed when something is
+ */
+void updatePowerMode() {
+  // Raw flags count, so the first sample of someone arriving wakes up
+  // without waiting for the debounce
+  bool active = sensorState.presenceDetected || sensorState.motionDetected || sensorState.flagged;
+#ifdef WIFI_SSID
+  active = active || streaming || remoteSettings.pattern != NUM_PATTERNS;
+#endif
+  
+  bool wasIdle = powerMode.isIdle();
+  if (powerMode.update(active) != wasIdle) {
+    Serial.println(wasIdle ? "Power mode: active" : "Power mode: idle");
+  }
 }
 
 void setup() {
   // Initialize serial communication for debugging
   Serial.begin(115200);
+#if !FAST_BOOT
   delay(2000); // Increased delay to give more time for serial port to initialize
   Serial.println("\n\n"); // Add extra newlines to clear any initial garbage
   
   // Test the serial connection
   testSerial();
+#endif
   
   Serial.println("Reactive LEDs - Starting...");
   
+#if SERIAL_TELEMETRY
+  // Sensor samples are streamed as binary frames (tools/telemetry_decode.py)
+  if (!startTelemetryTask()) {
+    Serial.println("Failed to start telemetry task");
+  }
+#endif
+  
   // Initialize I2C
   initI2C();
   
   // Initialize LED strip
   initLEDs();
   
-  // Initialize sensor using the SparkFun library
-  if (!presenceSensor.begin()) {
+  // Thresholds and rates tuned at runtime are kept in NVS
+  if (loadSensorConfig(sensorConfig)) {
+    Serial.println("Sensor configuration loaded from NVS");
+  }
+  
+  // Find and configure the presence sensors
+  if (initSensors() == 0) {
     Serial.println("Failed to initialize presence sensor");
     
     // If sensor not found, blink red three times
     for (int j = 0; j < 3; j++) {
       fill_solid(leds, LED_COUNT, CRGB::Red);
-      FastLED.show();
+      outputStage.present();
       delay(300);
-      FastLED.clear();
-      FastLED.show();
+      fill_solid(leds, LED_COUNT, CRGB::Black);
+      outputStage.present();
       delay(300);
     }
     
     // Then show a warning pattern
     ledPatterns.twinkle(CHSV(0, 255, 255), 20); // Red twinkle
-    FastLED.show();
+    outputStage.present();
   } else {
-    Serial.println("Presence sensor initialized successfully");
-    
-    // Configure the sensor based on the official examples
-    // Enter power-down mode by setting ODR to 0
-    presenceSensor.setTmosODR(STHS34PF80_TMOS_ODR_OFF);
-    
-    // Enable access to embedded functions registers
-    presenceSensor.setMemoryBank(STHS34PF80_EMBED_FUNC_MEM_BANK);
-    
-    // Set thresholds and hysteresis
-    presenceSensor.setPresenceThreshold(presenceThreshold);
-    presenceSensor.setMotionThreshold(motionThreshold);
-    presenceSensor.setPresenceHysteresis(hysteresis);
-    presenceSensor.setMotionHysteresis(hysteresis);
-    
-    // Disable access to embedded functions registers
-    presenceSensor.setMemoryBank(STHS34PF80_MAIN_MEM_BANK);
-    
-    // Enter continuous mode at 30Hz - using the highest available rate for maximum responsiveness
-    presenceSensor.setTmosODR(STHS34PF80_TMOS_ODR_AT_30Hz);
+    Serial.print(sensorBus.getSensorCount());
+    Serial.println(" presence sensor(s) initialized successfully");
+    initField();
     
     Serial.print("Presence threshold set to: ");
-    Serial.println(presenceThreshold);
+    Serial.println(sensorConfig.thresholds.presence);
     Serial.print("Motion threshold set to: ");
-    Serial.println(motionThreshold);
+    Serial.println(sensorConfig.thresholds.motion);
     Serial.print("Hysteresis set to: ");
-    Serial.println(hysteresis);
+    Serial.println(sensorConfig.thresholds.hysteresis);
+    Serial.print("Sensor rate set to: ");
+    Serial.print(sensorConfig.odrHz);
+    Serial.println(" Hz");
     
-    // Show success pattern
+    // Hand the sensors over to the background task on core 0
+    if (startSensorTask(sensorBus, sensorConfig, updateSensorConfig)) {
+      Serial.println("Sensor task started on core 0");
+    } else {
+      Serial.println("Failed to start sensor task");
+    }
+    
+    // Show success pattern (for one frame when booting fast)
     ledPatterns.gradient(CHSV(96, 255, 255), CHSV(160, 255, 255)); // Green to Blue gradient
-    FastLED.show();
+    outputStage.present();
+#if !FAST_BOOT
     delay(1000);
+#endif
+  }
+  
+#if BENCHMARK_MODE
+  // Sweep every pattern on the real hardware before normal operation starts
+  runBenchmark(ledPatterns, outputStage, Serial);
+#endif
+  
+  // Fade between patterns from here on; the boot indicators above cut hard
+  ledPatterns.setTransitionTime(PATTERN_TRANSITION_MS);
+  
+#if MOTION_SPARKLES
+  // The layer's buffers come from the pattern arena, which is sized for it
+  sparkleLayer = ledPatterns.addLayer(sparklePattern);
+  if (sparkleLayer < 0) {
+    Serial.println("Not enough pattern memory for motion sparkles");
   }
+#endif
+  
+#ifdef WIFI_SSID
+  // Commands change these from here on
+  remoteSettings.brightness = ledBrightness;
+  remoteSettings.transitionMs = PATTERN_TRANSITION_MS;
+  remoteSettings.sensor = sensorConfig;
+  if (startNetworkTask(remoteSettings)) {
+    Serial.print("Network task started on core 0, joining ");
+    Serial.println(WIFI_SSID);
+  } else {
+    Serial.println("Failed to start network task");
+  }
+#endif
   
   Serial.println("Setup complete");
+  
+  // Start frame pacing from here so setup time doesn't count as an overrun
+  powerMode.begin();
+  frameScheduler.begin();
 }
 
 void loop() {
-  // Read sensor data using the correct pattern from examples
-  sths34pf80_tmos_drdy_status_t dataReady;
-  presenceSensor.getDataReady(&dataReady);
-  
-  // Always read the latest data and update LEDs whether new data is available or not
-  sths34pf80_tmos_func_status_t status;
-  presenceSensor.getStatus(&status);
-  
-  // Update presence detection based on the flag
-  bool newPresenceDetected = (status.pres_flag == 1);
-  presenceSensor.getPresenceValue(&presenceValue);
-  
-  // Check if presence is above minimum threshold
-  bool presenceAboveThreshold = (abs(presenceValue) > PRESENCE_MIN_VALUE);
-  
-  // Apply debouncing logic for presence detection
-  if (presenceAboveThreshold && newPresenceDetected) {
-    // Value is above threshold - increment detection counter
-    presenceDetectionCount = min(presenceDetectionCount + 1, 255);
-    presenceNonDetectionCount = 0;
-    
-    // Only set as detected if we have enough consecutive detection frames
-    if (presenceDetectionCount >= DEBOUNCE_COUNT) {
-      presenceDetected = true;
-      // Calculate intensity using logarithmic scaling
-      float presenceScaled = abs(presenceValue);
-      presenceIntensity = constrain((uint8_t)(log10(presenceScaled + 1) * PRESENCE_LOG_SCALE_FACTOR), 0, INTENSITY_MAX);
-    }
-  } else {
-    // Value is below threshold - increment non-detection counter
-    presenceNonDetectionCount = min(presenceNonDetectionCount + 1, 255);
-    presenceDetectionCount = 0;
-    
-    // Only clear detection if we have enough consecutive non-detection frames
-    if (presenceNonDetectionCount >= DEBOUNCE_COUNT) {
-      presenceDetected = false;
-      presenceIntensity = 0;
-    }
-  }
+  uint32_t frameStart = profileCycles();
+  uint32_t inputStart = frameStart;
   
-  // Update motion detection based on the flag
-  bool newMotionDetected = (status.mot_flag == 1);
-  presenceSensor.getMotionValue(&motionValue);
+  // Pick up the latest debounced state published by the sensor task
+  bool newSensorData = readSensorSnapshot(sensorState);
   
-  // Check if motion is above minimum threshold
-  bool motionAboveThreshold = (abs(motionValue) > MOTION_MIN_VALUE);
+  // Use the higher of the two intensities for the LED pattern
+  uint8_t combinedIntensity = max(sensorState.presenceIntensity, sensorState.motionIntensity);
   
-  // Apply debouncing logic for motion detection
-  if (motionAboveThreshold && newMotionDetected) {
-    // Value is above threshold - increment detection counter
-    motionDetectionCount = min(motionDetectionCount + 1, 255);
-    motionNonDetectionCount = 0;
-    
-    // Only set as detected if we have enough consecutive detection frames
-    if (motionDetectionCount >= DEBOUNCE_COUNT) {
-      motionDetected = true;
-      // Calculate intensity using logarithmic scaling
-      float motionScaled = abs(motionValue);
-      motionIntensity = constrain((uint8_t)(log10(motionScaled + 1) * MOTION_LOG_SCALE_FACTOR), 0, INTENSITY_MAX);
-    }
-  } else {
-    // Value is below threshold - increment non-detection counter
-    motionNonDetectionCount = min(motionNonDetectionCount + 1, 255);
-    motionDetectionCount = 0;
-    
-    // Only clear detection if we have enough consecutive non-detection frames
-    if (motionNonDetectionCount >= DEBOUNCE_COUNT) {
-      motionDetected = false;
-      motionIntensity = 0;
-    }
+  if (newSensorData) {
+    reportSensorSample(combinedIntensity);
   }
+  profileRecord(PROFILE_INPUT, profileCycles() - inputStart);
   
-  // Store current values for next comparison
-  lastPresenceValue = presenceValue;
-  lastMotionValue = motionValue;
+  applyRemoteSettings();
+  updatePowerMode();
   
-  // Use the higher of the two intensities for the LED pattern
-  uint8_t combinedIntensity = max(presenceIntensity, motionIntensity);
-  
-  // Only print to serial when a detection occurs (prevents serial flooding)
-  if (presenceDetected || motionDetected) {
-    Serial.print("Sensor: ");
-    if (presenceDetected) Serial.print("Presence ");
-    if (motionDetected) Serial.print("Motion ");
-    Serial.print("- Presence Value: ");
-    Serial.print(presenceValue);
-    Serial.print(", Motion Value: ");
-    Serial.print(motionValue);
-    Serial.print(", Combined Intensity: ");
-    Serial.println(combinedIntensity);
+  // A network stream takes over from the patterns while it runs
+  if (!presentStreamFrame()) {
+    // Update LED pattern based on sensor readings
+    updateLEDPattern(sensorState.presenceDetected, sensorState.motionDetected, combinedIntensity);
   }
   
-  // Update LED pattern based on sensor readings
-  updateLEDPattern(presenceDetected, motionDetected, combinedIntensity);
+  reportFrameStats();
+  reportProfile();
+  profileRecord(PROFILE_FRAME, profileCycles() - frameStart);
   
-  // Small delay to prevent too frequent updates
-  delay(10); // Reduced delay for faster response
+  // Sleep off whatever is left of this frame's time slot
+  frameScheduler.waitForNextFrame();
 }
\ No newline at end of file
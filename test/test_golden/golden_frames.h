@@ -0,0 +1,1082 @@
+// Generated by: .pio/build/native/program --update-golden
+// Only regenerate after checking that a change in output is intended.
+const GoldenCase GOLDEN_FRAMES[] = {
+    { "solid", 150, 0x61a867e5, {
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03",
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03",
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03",
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03" } },
+    { "breathing", 150, 0x0c7a5847, {
+          "1e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e1300"
+          "1e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e1300"
+          "1e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e1300"
+          "1e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e1300"
+          "1e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e1300",
+          "472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01"
+          "472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01"
+          "472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01"
+          "472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01"
+          "472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01",
+          "100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00"
+          "100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00"
+          "100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00"
+          "100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00"
+          "100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00",
+          "613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01"
+          "613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01"
+          "613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01"
+          "613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01"
+          "613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01" } },
+    { "gradient", 150, 0x10845305, {
+          "ab6b03a96702a66302a55f02a56003a35c03a159039f55039e52039b4e039b4d049a4c049c49049b45049c43049d40049d3d059d3b059c3a049d37049c34049e32049e30059f2d059e2b059c2a059d28069d26059e24059d21059e1f069d1d06"
+          "9c1c069c1b069b19069d17069b16069c14079814079a1207991007990e06980f07970c07960b07950a079708079507079308089108088c070a89080c86080d84080e8008107d08107c08107908127408137308147108156c08166b0918690817"
+          "67081863091961091a5e081b5c091c59091c58081c56091d53091d51081e50091f4f091f4c091f4a09204809204509204509214309214109213e09213d09223c09223a09223a09223709223509233409223209233109232f08232f08232d0923"
+          "2c09232a09232a09232808232709232608232408222308222208222108221f08221e08221e08211d08211c08201b08201a082019082018081f18081f17071f15071e15071e14071e13071d13071d12071d12071d11071b11071b10071b0f061a"
+          "0f061a0e061a0d06190d06190d06190c06170b06180b06160a06170a0516090515090515090515080514080513070513070513070512070512060412060411060411",
+          "ab6b03a96702a66302a55f02a56003a35c03a159039f55039e52039b4e039b4d049a4c049c49049b45049c43049d40049d3d059d3b059c3a049d37049c34049e32049e30059f2d059e2b059c2a059d28069d26059e24059d21059e1f069d1d06"
+          "9c1c069c1b069b19069d17069b16069c14079814079a1207991007990e06980f07970c07960b07950a079708079507079308089108088c070a89080c86080d84080e8008107d08107c08107908127408137308147108156c08166b0918690817"
+          "67081863091961091a5e081b5c091c59091c58081c56091d53091d51081e50091f4f091f4c091f4a09204809204509204509214309214109213e09213d09223c09223a09223a09223709223509233409223209233109232f08232f08232d0923"
+          "2c09232a09232a09232808232709232608232408222308222208222108221f08221e08221e08211d08211c08201b08201a082019082018081f18081f17071f15071e15071e14071e13071d13071d12071d12071d11071b11071b10071b0f061a"
+          "0f061a0e061a0d06190d06190d06190c06170b06180b06160a06170a0516090515090515090515080514080513070513070513070512070512060412060411060411",
+          "ab6b03a96702a66302a55f02a56003a35c03a159039f55039e52039b4e039b4d049a4c049c49049b45049c43049d40049d3d059d3b059c3a049d37049c34049e32049e30059f2d059e2b059c2a059d28069d26059e24059d21059e1f069d1d06"
+          "9c1c069c1b069b19069d17069b16069c14079814079a1207991007990e06980f07970c07960b07950a079708079507079308089108088c070a89080c86080d84080e8008107d08107c08107908127408137308147108156c08166b0918690817"
+          "67081863091961091a5e081b5c091c59091c58081c56091d53091d51081e50091f4f091f4c091f4a09204809204509204509214309214109213e09213d09223c09223a09223a09223709223509233409223209233109232f08232f08232d0923"
+          "2c09232a09232a09232808232709232608232408222308222208222108221f08221e08221e08211d08211c08201b08201a082019082018081f18081f17071f15071e15071e14071e13071d13071d12071d12071d11071b11071b10071b0f061a"
+          "0f061a0e061a0d06190d06190d06190c06170b06180b06160a06170a0516090515090515090515080514080513070513070513070512070512060412060411060411",
+          "ab6b03a96702a66302a55f02a56003a35c03a159039f55039e52039b4e039b4d049a4c049c49049b45049c43049d40049d3d059d3b059c3a049d37049c34049e32049e30059f2d059e2b059c2a059d28069d26059e24059d21059e1f069d1d06"
+          "9c1c069c1b069b19069d17069b16069c14079814079a1207991007990e06980f07970c07960b07950a079708079507079308089108088c070a89080c86080d84080e8008107d08107c08107908127408137308147108156c08166b0918690817"
+          "67081863091961091a5e081b5c091c59091c58081c56091d53091d51081e50091f4f091f4c091f4a09204809204509204509214309214109213e09213d09223c09223a09223a09223709223509233409223209233109232f08232f08232d0923"
+          "2c09232a09232a09232808232709232608232408222308222208222108221f08221e08221e08211d08211c08201b08201a082019082018081f18081f17071f15071e15071e14071e13071d13071d12071d12071d11071b11071b10071b0f061a"
+          "0f061a0e061a0d06190d06190d06190c06170b06180b06160a06170a0516090515090515090515080514080513070513070513070512070512060412060411060411" } },
+    { "rainbow", 150, 0xdf565f5d, {
+          "01966a01916f01867a017b8501768a016b9501619f015ba50151af0146ba0141bf0136ca012bd50121df011be50111ef0106fa0101ff0501fa0a01f50d01f21201ed1801e71d01e22001df2501da2b01d42d01d23301cc3801c73b01c44001bf"
+          "4501ba4b01b44d01b25301ac5701a95a01a65f01a165019b6701996d019372018e7701897a018680018085017b8801788d017392016e95016b9a0166a00160a5015ba80158ac0153b2014db4014bba0145bf0140c2013dc70138cc0133d2012d"
+          "d5012ada0125df0120e2011de70118ed0112ef0110f5010afa0105ff0101fd0201f70801f20d01ef1001ea1501e51a01e21d01dd2201d72801d22d01cf3001ca3501c43b01c23d01bc4301b74801b44b01af5001ab5501ab5a01ab5d01ab6201"
+          "ab6701ab6a01ab6f01ab7501ab7701ab7d01ab8201ab8801ab8a01ab9001ab9501ab9801ab9d01aba201aba501abaa01a1af0196b40191b70186bc017bc20176c4016bca0161cf015bd20151d70146dd013be20136e5012bea0121ef011bf201"
+          "11f70106fd0101ff0101fa0501f50a01f20d01ed1201e71801e21d01df2001da2501d42b01d22d01cc3301c73801c43b01bf4001ba4501b44b01b24d01ac5301a65a",
+          "ea1501e71801e21d01dd2201da2501d42b01cf3001cc3301c73801c23d01bf4001ba4501b44b01af5001ac5301ab5701ab5d01ab5f01ab6501ab6a01ab6d01ab7201ab7701ab7d01ab8001ab8501ab8a01ab8d01ab9201ab9801ab9a01aba001"
+          "aba501abaa01a6ac019bb20191b7018bba0181bf0176c40171c70166cc015bd20151d7014bda0141df0136e50131e70126ed011bf20116f5010bfa0101ff0101fa0501f70801f20d01ed1201ea1501e51a01df2001dd2201d72801d22d01cc33"
+          "01ca3501c43b01bf4001bc4301b74801b24d01af5001ab5501a15f01966a01916f01867a017b8501768a016b9501619f015ba50151af0146ba013bc50136ca012bd50121df011be50111ef0106fa0101ff0501fa0a01f51001ef1201ed1801e7"
+          "1d01e22001df2501da2b01d42d01d23301cc3801c73d01c24001bf4501ba4b01b44d01b25301ac5701a95a01a65f01a165019b6a01966d019372018e7701897a018680018085017b8801788d017392016e9801689a0166a00160a5015ba80158"
+          "ac0153b2014db4014bba0145bf0140c2013dc70138cc0133d2012dd5012ada0125df0120e2011de70118ed0112ef0110f5010afa0105ff0101fd0201f70801f20d01",
+          "016b9501669a015ba50151af014bb50141bf0136ca0131cf0126da011be50116ea010bf50101ff0501fa0801f70d01f21201ed1501ea1a01e52001df2201dd2801d72d01d23301cc3501ca3b01c44001bf4301bc4801b74d01b25001af5501ab"
+          "5a01a65f01a162019e6701996d01936f019175018b7a01867d018382017e8801788d017390017095016b9a01669d0163a2015ea80158aa0155af0150b4014bba0145bc0143c2013dc70138ca0135cf0130d5012ad70128dd0122e2011de70118"
+          "ea0115ef0110f5010af70108fd0102fd0201fa0501f50a01ef1001ea1501e71801e21d01dd2201da2501d42b01cf3001cc3301c73801c23d01bc4301ba4501b44b01af5001ac5301ab5701ab5d01ab5f01ab6501ab6a01ab6f01ab7201ab7701"
+          "ab7d01ab8001ab8501ab8a01ab8d01ab9201ab9801ab9d01aba001aba501abaa01a6ac019bb20191b7018bba0181bf0176c4016bca0166cc015bd20151d7014bda0141df0136e50131e70126ed011bf20111f7010bfa0101ff0101fa0501f708"
+          "01f20d01ed1201ea1501e51a01df2001dd2201d72801d22d01cc3301ca3501c43b01bf4001bc4301b74801b24d01af5001ab5501a15f01966a01916f01867a017b85",
+          "d42b01d22d01cc3301c73801c43b01bf4001ba4501b74801b24d01ac5301ab5501ab5a01ab5f01ab6501ab6701ab6d01ab7201ab7501ab7a01ab8001ab8201ab8801ab8d01ab9201ab9501ab9a01aba001aba201aba801a6ac01a1af0196b401"
+          "8bba0181bf017bc20171c70166cc0161cf0156d5014bda0146dd013be20131e70126ed0121ef0116f5010bfa0106fd0101fd0201f70801f50a01ef1001ea1501e51a01e21d01dd2201d72801d42b01cf3001ca3501c73801c23d01bc4301b748"
+          "01b44b01af5001ab5501a65a019b6501916f018b7501817f01768a016b9501669a015ba50151af014bb50141bf0136ca0131cf0126da011be50111ef010bf50101ff0501fa0801f70d01f21201ed1501ea1a01e52001df2501da2801d72d01d2"
+          "3301cc3501ca3b01c44001bf4301bc4801b74d01b25301ac5501ab5a01a65f01a162019e6701996d01936f019175018b7a018680018082017e8801788d017390017095016b9a01669d0163a2015ea80158ac0153af0150b4014bba0145bc0143"
+          "c2013dc70138ca0135cf0130d5012ad70128dd0122e2011de70118ea0115ef0110f5010af70108fd0102fd0201fa0501f50a01ef1001ea1501e71801e21d01dd2201" } },
+    { "chase", 150, 0x6feb3c7a, {
+          "050410050410050410050410050410050410050410050410472d0aab6b03ab6b03ab6b03684107050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410",
+          "0504100504100504100504100504100504100504100504100504100504100504100504101e130dab6b03ab6b03ab6b03915b04050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410",
+          "0504100504100504100504100504100504100504100504100504100504100504100504100504100504100504100504100504109b6103ab6b03ab6b03ab6b03140d0e050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410",
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410714706ab6b03ab6b03ab6b033e270b050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410" } },
+    { "pulse", 150, 0xee1f4e89, {
+          "1e1300321f00492d01633e017e4e02925b02a16502a96a02a26502965e028251026942014e3101362100221500120b000905000402000201000100000100000100000201000402000b0700150d002617003a24015435016e45018654029a6002"
+          "a46602a869029e63028e5902794c025e3a01442b012e1c001b11000e09000604000201000100000100000100000100000201000604000e09001b11002e1c00442b015e3a01794c028e59029e6302a86902a466029a60028654026e4501543501"
+          "3a2401261700150d000b0700040200020100010000010000010000020100040200090500120b002215003621004e3101694201825102965e02a26502a96a02a16502925b027e4e02633e01492d01321f001e1300100a00080500030200010000"
+          "0100000100000100000201000503000c0700180f002a1a003f27015938017448028956029d6202a56702a567029d62028956027448025938013f27012a1a00180f000c0700050300020100010000010000010000010000030200080500100a00"
+          "1e1300321f00492d01633e017e4e02925b02a16502a96a02a26502965e028251026942014e3101362100221500120b00090500040200020100010000010000010000",
+          "472c01301e001d12000f09000704000302000100000100000100000100000201000603000d08001a10002c1b004229015c39017649028c57029e6302a66802a567029d62028855027046015736013d2601281900170e000c0700040200020100"
+          "010000010000010000010000040200080500110a002014003420004c2f01663f01805002945d02a16502ab6b03a16502945d02805002663f014c2f01342000201400110a000805000402000100000100000100000100000201000402000c0700"
+          "170e002819003d26015736017046018855029d6202a56702a668029e63028c57027649025c39014229012c1b001a10000d08000603000201000100000100000100000100000302000704000f09001d1200301e00472c01613d017c4e028f5902"
+          "a06402a86902a46602985f028452026b4301523301382300241600140c000a06000402000201000100000100000100000201000402000a0600140c002416003823005233016b4301845202985f02a46602a86902a064028f59027c4e02613d01"
+          "472c01301e001d12000f09000704000302000100000100000100000100000201000603000d08001a10002c1b004229015c39017649028c57029e6302a66802a56702",
+          "100a001e1300321f00492d01633e017e4e02925b02a16502a96a02a26502965e028251026942014e3101362100221500120b000905000402000201000100000100000100000201000402000b0700150d002617003a24015435016e4501865402"
+          "9a6002a46602a869029e63028e5902794c025e3a01442b012e1c001b11000e09000604000201000100000100000100000100000201000604000e09001b11002e1c00442b015e3a01794c028e59029e6302a86902a466029a60028654026e4501"
+          "5435013a2401261700150d000b0700040200020100010000010000010000020100040200090500120b002215003621004e3101694201825102965e02a26502a96a02a16502925b027e4e02633e01492d01321f001e1300100a00080500030200"
+          "0100000100000100000100000201000503000c0700180f002a1a003f27015938017448028956029d6202a56702a567029d62028956027448025938013f27012a1a00180f000c0700050300020100010000010000010000010000030200080500"
+          "100a001e1300321f00492d01633e017e4e02925b02a16502a96a02a26502965e028251026942014e3101362100221500120b00090500040200020100010000010000",
+          "613d01472c01301e001d12000f09000704000302000100000100000100000100000201000603000d08001a10002c1b004229015c39017649028c57029e6302a66802a567029d62028855027046015736013d2601281900170e000c0700040200"
+          "020100010000010000010000010000040200080500110a002014003420004c2f01663f01805002945d02a16502ab6b03a16502945d02805002663f014c2f01342000201400110a00080500040200010000010000010000010000020100040200"
+          "0c0700170e002819003d26015736017046018855029d6202a56702a668029e63028c57027649025c39014229012c1b001a10000d08000603000201000100000100000100000100000302000704000f09001d1200301e00472c01613d017c4e02"
+          "8f5902a06402a86902a46602985f028452026b4301523301382300241600140c000a06000402000201000100000100000100000201000402000a0600140c002416003823005233016b4301845202985f02a46602a86902a064028f59027c4e02"
+          "613d01472c01301e001d12000f09000704000302000100000100000100000100000201000603000d08001a10002c1b004229015c39017649028c57029e6302a66802" } },
+    { "fire", 150, 0xd5a21da9, {
+          "000000fffffcff0000ffff34f40000fffffcff0400ff3000ff5000ffff24ffff70ffd800ff5800ff1000ff0c00fc0000fc0000fc0000f40000f80000ff0400ff1000ff3c00ff6400ff8000ff7c00ff6400ff5400ff4c00ff2800ff0000e40000"
+          "f40000ff0400ff1000ff2400ff1c00ff0c00f00000d40000c80000cc0000c80000c40000ac0000a00000880000600000280000080000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+          "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+          "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+          "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+          "ffc000ffff2cffe400ffff14fff400ffff08fff400ffff04fff800ffff04ffff20ffff48ffff58ffff40ffff38ffff54ffff6cffff6cffff5cffff4cffff40ffff24ffff08fff000fff000fff800ffe800ffdc00ffd800ffd000ffcc00ffb400"
+          "ff9800ff8000ff7000ff5c00ff5400ff4400ff3000ff2800ff2800ff3400ff3c00ff4800ff4400ff4000ff4000ff4000ff4c00ff4c00ff3400ff1800f80000d40000b000009c00009c00009c0000a40000ac0000b000009c00007c0000640000"
+          "3c00002800001800000c00001000001c00002800002800003c00005000005800006000006400005400004400002800001c00001800000c00000c00000c00000800000c0000040000000000000000000000000000000000000000000000000000"
+          "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+          "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+          "ffff40ffffc4fffffcffffa0ffff78ffff9cffff90ffffa4ffffacffffa0ffff90ffff90ffff84ffff7cffff80ffff8cffff8cffff88ffff84ffff8cffff90ffff94ffff8cffff74ffff64ffff58ffff5cffff5cffff60ffff6cffff68ffff60"
+          "ffff58ffff44ffff38ffff30ffff2cffff2cffff28ffff18ffff14ffff0cfff800ffd800ffb400ff9800ff9000ff8400ff7800ff7000ff6400ff4c00ff2c00ff1c00ff1400fc0000f40000fc0000ff0400ff1400ff2c00ff4000ff5400ff5800"
+          "ff6000ff6400ff6000ff5000ff4c00ff4000ff3000ff2000ff1c00ff1400ff0000f80000f00000e40000d80000c80000b80000b00000a000009000007400006400005400004400003c00004000004c0000480000540000580000540000440000"
+          "3c00003c00003c00003000002800001800000c0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+          "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+          "ffff60ffff88ffff6cffff78ffff68ffff88ffffa4ffffa8ffff7cffff88ffff9cffffbcffffb8ffff94ffff84ffff80ffff80ffff78ffff7cffff70ffff7cffff7cffff78ffff78ffff6cffff64ffff58ffff4cffff48ffff3cffff38ffff40"
+          "ffff3cffff2cffff2cffff38ffff34ffff2cffff24ffff1cffff18ffff10ffff04fffc00fff000ffe000ffd800ffd400ffcc00ffbc00ffb400ffb400ffc400ffc000ffb400ffa000ff9000ff8c00ff9000ff9c00ff9c00ff9000ff8800ff8400"
+          "ff8000ff8000ff8000ff7c00ff8000ff8400ff8400ff8000ff8000ff8400ff8000ff7400ff7000ff6400ff6400ff6400ff7000ff6000ff5800ff4c00ff4400ff3c00ff3c00ff2c00ff2800ff2000ff1000ff0000e80000c80000b40000a80000"
+          "9400008400007c00007400007000006800005400004400002400001000000400000400000c00001400002c00004800004800004800004c00005400005400004800004c00004c00004800004800004000002400000c0000000000000000000000"
+          "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000" } },
+    { "twinkle", 150, 0x31b94932, {
+          "ab6b03452b01845302ab6b039d6202a46602523301623d01965e02623d018a5602905a024c2f01ab6b037046019d6202744902a46602a466028a5602905a028a56029d62028453029d6202ab6b038453028a5602744902905a026b4301704601"
+          "ab6b035a3801905a02704601ab6b03845302905a02ab6b032c1b00965e02704601a46602704601ab6b039d62027f4f02ab6b039d6202905a02664001a46602a466026640017449026b4301905a029d62027f4f026b43018a5602905a022e1c00"
+          "5e3b01ab6b03965e02a46602965e02965e027f4f02ab6b03965e02ab6b038a5602ab6b037449026640018a5602563601a46602a466027f4f02a466025636017f4f02905a027449027f4f02a46602a466024f3101623d01a46602a46602a46602"
+          "a466029d62025e3b01744902845302a466027f4f02905a029d62023a24019d6202905a02965e027a4c02965e02965e029d62027449023f2701905a02ab6b034c2f018453029d6202a46602563601905a02845302301e00a46602321f00523301"
+          "7a4c027046019d62025e3b016b43019d6202a46602ab6b03ab6b03ab6b037449023a2401965e02301e008a5602965e02a466027f4f027f4f02965e02965e025e3b01",
+          "6b4301a46602482d018a5602a466027449027f4f02ab6b03905a029d6202523301a46602523301ab6b039d6202905a02ab6b03965e027a4c028453028453027f4f025e3b01905a020d0800a46602965e029d6202ab6b03664001ab6b03623d01"
+          "8a5602ab6b037046019d6202965e028a5602965e028a5602845302563601965e027a4c029d62027046018453028a56025636018453028a5602965e02845302ab6b03ab6b03704601744902905a029d6202845302905a024f3101ab6b035a3801"
+          "8453027f4f025636016b4301664001905a02452b017046014f31018a5602965e028453029d62028453026640017f4f02ab6b037f4f02ab6b037f4f026b4301ab6b03ab6b038a56025e3b01a466029d62029d62026640015e3b01ab6b037a4c02"
+          "482d01ab6b03ab6b036b43019d62023a24018453027a4c02ab6b03704601905a029d62027f4f025a3801a466027f4f023a2401ab6b03a46602965e029d6202704601965e02744902a466025636019d62027046017f4f028a56025a3801a46602"
+          "a46602905a023c2601965e026b4301321f004f3101704601ab6b039d6202623d01ab6b03965e02a466029d6202905a02563601ab6b037a4c024c2f019d6202452b01",
+          "482d01905a02a46602905a02965e028453029d6202ab6b03623d01452b01905a029d6202a466027449028453029d6202845302965e025636015e3b018a56025636017449028a56027a4c02744902ab6b035e3b01905a02452b013c26014c2f01"
+          "744902623d01482d016b4301321f00ab6b03664001ab6b03a46602965e02905a028a56022c1b00704601a466027449022416008a5602965e024c2f01905a028a5602744902965e027a4c02563601965e02664001a46602a466028a5602ab6b03"
+          "623d017a4c02845302a46602905a026640015636019d6202ab6b037f4f02ab6b037f4f027a4c025e3b01623d01ab6b035e3b017f4f025e3b01241600905a02a466026b43012014004229018453028453027f4f02ab6b03a46602a46602664001"
+          "6b43019d6202563601965e029d6202704601a466026b4301ab6b03704601ab6b03965e022617004f3101ab6b031e1200905a02a46602905a02482d019d6202452b018453029d6202965e02965e02965e029d62027f4f027a4c025e3b01623d01"
+          "845302a46602704601a466027f4f028453027f4f02965e02905a027f4f02ab6b03965e02905a02482d01965e02a466025636018a56026b4301452b017a4c02321f00",
+          "a466029d6202744902a46602523301965e02a466027a4c02744902744902664001ab6b03a46602965e02422901965e028453025233015e3b01a466029d62025e3b01ab6b037a4c029d6202a466028a5602ab6b03a466028a5602523301422901"
+          "9d62027f4f02704601a466027a4c02a466024c2f01845302845302482d01a46602905a027a4c02482d01a46602ab6b03965e029d6202744902965e027f4f02482d015a38015233019d62029d62028a56024c2f01704601a46602905a02ab6b03"
+          "9d62029d6202965e025a38015636016b43017a4c02422901905a023421007f4f02965e027a4c02965e027a4c029d6202ab6b03704601180f007f4f02a466029d6202744902ab6b034c2f01965e02ab6b03905a029d62026b4301965e02744902"
+          "965e027f4f025e3b01ab6b03ab6b035e3b01ab6b03a46602965e02ab6b039d62029d6202a466027a4c02482d014c2f017a4c02523301623d01a46602452b019d6202ab6b03905a02a46602ab6b034f3101ab6b036b43017f4f024229017a4c02"
+          "6640017f4f021b1100965e02ab6b035a3801845302a466026640019d62028a56029d6202452b01a46602a466027f4f02965e02a46602905a02ab6b03a46602965e02" } },
+    { "field", 150, 0xe126f000, {
+          "997504977904937a048f7b058a7b04877f05817f06757f05677f06548106437f07377f072a7d081d7b08127708087508096a0c085f0f095612094f15094816084417094018083d18093c18083b18093c18083d18094018084417094816094f15"
+          "095612085f0f09690c0875081277081d7b082a7d08377f07437f07548106677f06757f05817f06867d058a7b048e7a049179049579049978049b75039d74039e7503a17403a17103a27203a37103a37103a37103a37103a37103a37103a27203"
+          "a27203a27203a17103a17103a17103a17403a17403a174039f73039f73039f73039f73039f73039f73039f7303a17403a17403a17403a17103a17103a17103a27203a27203a27203a37103a37103a37103a27203a27203a27203a17103a17403"
+          "9e75039d74039b75039978049578049179048e7a048a7b04867d05817e05707f06617f064f80073f7f072d7e07207c0814780808740808660d085a11095015084616083e1808371908311a082d1a082a1a08261c08251c08241c08251c08261c"
+          "082a1a082d1a08311a083719083e18084616095015085b1108660d087408147808207c082d7e073f7f07508107618006757f06817e05877f058a7b048f7b05937a04",
+          "957904907a058d7b04897e05837e05757f05657e06508107408007307e08207a0812790809720909620e095514094816083f18083619082f1a08281b08211d071c1e07181f07161e07151e07141e07151e07161e07181f071c1e08211d08281b"
+          "082f1a083619083e1809481608531308600f086f0a0f77081d7b082a7e073b7e07478106588006677f06757f05817e05847f05857e05877f05877c05877c05877f05857e05847f05818005797d056b7f065c7f06508107437f073880072d7c07"
+          "207c08187a080f7608087408086c0b09640f095c11095912085313095113095015094f15095015095113085313095912095c1109640f086c0b0874080f7708187a08237b082d7e073b7e07478106548106677f06757f05817e05857e05897c04"
+          "8e7d04917b05937a049578049978049a76049b75039d76039d74039e75039e75039d74039d74039d76039b75039a7604997504997804987704957804957904937a04937a04917904907a05907a058f7b058e7a048e7a048e7a048e7a048e7a04"
+          "8f7b05907a05907a05917904937a049478049579049779049877049975049a76049d76039d74039f7303a17403a17103a27203a37103a46e02a46e02a56f02a66d02",
+          "a46e02a57203a37103a27203a174039e75039d74039b7503997504977904957904937a04907a058e7a048b7d048a7d04877c05867d05847d05837e05817e058180057f7e057a7f05797d05797d05797d057a7f057f7e05818005817e05837e05"
+          "847d05857e05877f05897c048a7b048d7b048e7a04907a05917904937a04957904957804957804957804957904947804937a04907a058e7d048a7d04877f05837e05797d05677f06537f07437f07337e07207c0812790809720909620e085313"
+          "094717093c1808321a082a1a08211d07191e07141e07111f070e1e060c1c060b1c060b1d060b1c060c1c070e1e07111f07141e07191e08211d082a1a08321a083b1809471709521409620e087009127708207a08307e083f7f074f8007617f06"
+          "6f7e067a7f05817f06857e05877f05897e05897e05897e05877c05867d05847d05817f067a7f056f7e066180065880064b7f063f7f07347f072a7e07237b081a79081478080d7808087508087009086c0b09690c08660d08660d08660d09690c"
+          "086c0b0870090875080d78081478081a7a08237d082d7c07377f07437f074f80075c7f066b7f067a7f05837e05877f058a7b048e7a049179049578049978049b7503",
+          "a174039d74039b7503997504957804937a048f7b058b7d04897c04857e05817e05757f056a7f065c7f065081074780063f7f07347f072d7e07267d08207c081d7b081a7908187a08157908157908157908187a081a79081d7b08207c08267d08"
+          "2d7e07347f073b80074780065081075c7f066a7f06757f05818005847f05877c058a7b048e7d04907a05937a04957904977904987704997804997804997804997804987704977904957904937a04917b058e7a048b7d04897c04877f05847d05"
+          "817f067f7e05757f066b7f06677f06617f065c7e065481065081074f80074c80074c80074c80074f80075081075481065c7e06617f06677f066b7f06757f067a7f05817e05847f05867d05897e058a7d048b7d048e7a048f7b05907a05917b05"
+          "907a05907a058e7a048d7b048a7d04877f05837e057f7e056b7f06588006478006377f07267d0817780808750808650d095514094717083a1908311a08261c071c1e07151e070f1e060c1d06091b05071a05061a05051805051805051805061a"
+          "05071a06091b060c1d070f1e07151e071d1d08261c08311a083a1909471709551408660d0b7408187a082a7d083b7e074c8007617f06757f05837e05877c058b7d04" } },
+    { "transitions", 150, 0x7631d799, {
+          "1c12003a280350360b694400834b01965d01a56001ac6c01a66b079a5d01854d016f4100552e003e1f002b17001b0a000b04000301000100000000000000000000000100000301000a0600140c00241600372200503200694200805001935b01"
+          "9c6101a06401975e018755017348015937004129002c1a001910000d08000503000100000000000000000000000000000100000503000d08001910002c1a00412900593700734801875501975e01a064019c6101935b01805001694200503200"
+          "372200241600140c000a0600030100010000000000000000000000010000030100080400110a00201400331f004a2e00643f007c4d018f59019b6001a165019a60018b5701784a015e3b00452b002f1d001c12000f0900070400020100000000"
+          "0000000000000000000100000402000b0600160e002818003c25005535006f4401835201965d019d62019d6201965d018352016f44015535003c2500281800160e000b06000402000100000000000000000000000000000201000704000f0900"
+          "1c12002f1d00452b005e3b00784a018b57019a6001a165019b60018f59017c4d01643f004a2e00331f00201400110a00080400030100010000000000000000000000",
+          "653e03663f041e13034f30033b25033a24033b25030101033521033320030000033521035736005e3a00603c00301e005132025736044e3103633e036e4503724703794c037549037e4f043924036a4203623d04492d03432803392303050303"
+          "0201030100030000033521030000030000033e27040302033c2503462c03482c03583703291903653e036640037b4d037b4d037d4e037b4d046b43035837035d3a044e31033d26033c26030302033e27043420030000033823030000032a1a03"
+          "392403050303321f033f2603180f032316032d1d036740036f44037e4e037146034129033b25036f4504613c03452c03462c030b07030603033c2503392303332003311e033a2403311e033923030201034329040b0703442a031c1203613c03"
+          "633d036e4503412903835104442a03784a03674003654003231603523303100903432903301e030101030100032b1b033a24033521033420032e1d030302033c26030e09034b2f034d3003684104704603764a03805004462c03805004724703"
+          "714604583603533403150c030c0803301e034028043622033d26043d26042f1d033a24033923033722033823033b2403432803452b03583703301e036c4403412903",
+          "7449029d62027f4f028453029d6202ab6b03965e02845302ab6b039d6202ab6b03ab6b037f4f027046018a56025a38017449027f4f02965e02a466029d6202ab6b03704601ab6b035a3801965e028a5602ab6b03905a027046019d62027a4c02"
+          "905a027449028a5602905a02ab6b037449029d6202704601845302ab6b037f4f028453029d6202a466027f4f027a4c026b43015a38019d62028a5602965e029d6202482d01ab6b038a56028a56026b4301905a028453026b4301ab6b03a46602"
+          "ab6b035636017046017f4f029d6202ab6b03845302965e029d6202744902905a023c2601ab6b03905a029d62029d6202744902965e02ab6b039d6202905a029d6202965e024f31018a56027a4c02905a02ab6b037449029d6202ab6b03965e02"
+          "a466022c1b00a466025e3b01623d01965e02ab6b038a56023f2701845302845302965e028a5602523301563601965e025a3801744902623d011c11008a5602965e02905a027a4c027a4c024229017f4f028a5602ab6b03ab6b03a46602845302"
+          "ab6b03ab6b034f31017a4c028a5602965e02ab6b035a3801965e02965e025e3b01965e027f4f029d62029d6202965e02965e02744902704601a466028a5602ab6b03",
+          "01966a01916f01867a017b8501768a016b9501619f015ba50151af0146ba0141bf0136ca012bd50121df011be50111ef0106fa0101ff0501fa0a01f50d01f21201ed1801e71d01e22001df2501da2b01d42d01d23301cc3801c73b01c44001bf"
+          "4501ba4b01b44d01b25301ac5701a95a01a65f01a165019b6701996d019372018e7701897a018680018085017b8801788d017392016e95016b9a0166a00160a5015ba80158ac0153b2014db4014bba0145bf0140c2013dc70138cc0133d2012d"
+          "d5012ada0125df0120e2011de70118ed0112ef0110f5010afa0105ff0101fd0201f70801f20d01ef1001ea1501e51a01e21d01dd2201d72801d22d01cf3001ca3501c43b01c23d01bc4301b74801b44b01af5001ab5501ab5a01ab5d01ab6201"
+          "ab6701ab6a01ab6f01ab7501ab7701ab7d01ab8201ab8801ab8a01ab9001ab9501ab9801ab9d01aba201aba501abaa01a1af0196b40191b70186bc017bc20176c4016bca0161cf015bd20151d70146dd013be20136e5012bea0121ef011bf201"
+          "11f70106fd0101ff0101fa0501f50a01f20d01ed1201e71801e21d01df2001da2501d42b01d22d01cc3301c73801c43b01bf4001ba4501b44b01b24d01ac5301a65a" } },
+    { "layers", 150, 0x92287462, {
+          "cac0aedac8abffffffffe6abfffff6ffffd0ffffe2eaae3fffffe2fff29affffd9fff5b6fff4c6e8cdae847662f2ebe1ffffffbcb7b6c5bebec3bebe8f8d8dd8d8d8ffffffe4e2e1fffffffffff5e2d4bee5d0aeffffd8fff8b6fffffffffff6"
+          "ffffd9fffff6ffffb7ffffecfffff6ffffcfffffe1fff2d8c0b7a7c3beb6ffffffa1a0a0ebebebebebebbebebebebebeb7b6b63533309a958dffffff9d8b71ffffffffffffffffe2875501ffffa8ffdf7cffffffffffd9ffe394ffffbeffffeb"
+          "ffffffe2d4bec2baaef5f1ebf8f6f59a9999e1e1e1767676ffffffd9d8d8aaa8a7ffffffc7c0b6fff5e1ffffffffffd8fffdbeedbe72e9b35bffffbfffd16dffffe2ffffbfffffbfb08d52fffacffeeccffffff5ffffffe8e5e1a9a8a7d8d8d8"
+          "ffffffaeaeaeb6b6b6fffffff9f7f5ffffffa39b8dfff0d8f2dbb6ffffebfff2affffff6fff094ffffb7ffe382ffea8effffbfffffe2bc9c67ffffffcfbfa7ffffffece7e1918f8dffffffd8d8d8e1e1e1e1e1e1bebebe605f5efcf9f5f0eae1"
+          "fdf3e1ffffffffe9beebc88dffffecffe48efff394ffffecffffafffffd0c6974bfdd899fffff5ffffe1efe3cffffffff3efebf8f6f5fffffff5f5f5bebebeebebeb",
+          "ffffffffffcdffffddfedfb53d393bfff7d5ffffffffffffe8d9c4ffffe6fff4dd6c5842ebc79aa1679dfffff4fffffad0b5cafffffafff9e6ffffeffffffffff9d5fffffffffff9fffff9ffffeffffffffffbccfffed5ffffffffffe6fffff9"
+          "ffffffae9b85ececefececefdbc5a8fce8ccfffde6ffffffd7d4d5fce9ccffffeff9dbaeffffffe3b87cffffd5c69956ffffe6ffffddfffabdffffeff2e2ccffffefe1c6a1fffffffffff9ffffffe3e3e6876f54fffff9bfa98bfffffff2d4d4"
+          "ba86a9d6c1ddfae1d9ffe6c4ffffddffffe7e2bf8af7e2c4ffffe6ffffddfff0a8fffff9fae4c4ffe2aeffffffffffddffffff84715afffffffffff9c6b29bffffefe2e2e678644dd1ba9c77634dffffe6fffff088755dffffd6cbc1b5fffff9"
+          "ffe1aeffffefffd896ffffc4ffffddfff7d5ffffcdffffefffffd6fae1bd9f85658a7256dbc5a8d8c1a2b0afb5f6f6f9fff3d7b999c8d9c6e1fffff6ffeedfbba381ffe9c4fffff9fffcccfffec4fffcc49a8365fffad5ffffc4fffff9ffebae"
+          "ffffefeac99bffffe6a49b96dac5a8ffffffc2c1c4ffffeff6f6f9a9a9aefce8cc998976c8c7ccfee6c5f7e5ccffeaccb3aba8f5d5a8fffff9ffffefc69c5dad7f3c",
+          "ffffccfffff9ffdf80ffffefffffdcffffffffffc5ffd99bffffb5ffffffffffccffffd4ffffe6fff4e4fffffff6bb64ffffffffd9ffffffffffe0fffffffffffffffeca7fffffc5ffffdeffffeeffffbcffffddd4a460ffeebbfff3dbffffef"
+          "ffffffeebe7af2c789fffffffff9aeffffe5fed395ffffefffffc4e8cba6fff596ffffbcfec36cffffeffffffffffffffff9dcfffca1ccb394fffffffffff9fffffaffffffffffe6ffffffffffeffff6c3fffff9ffffcbffffe6ffdc9bbf8126"
+          "ffffffffffdcfffff8ffffffffe1ffffffffffb8ffffde89ffffccffffd5ffffffffffbcffffe6ffffccffffffffcf84fffffffffffffffffffff9c3fffff9ffffc4ffffefffffffffc368ffffddfad094fffff9fffffffffffff9dbb4ffd889"
+          "ffffc4fffff9fff0b4fff0b4ffffccffffd4ffdca0ffffeee4bc83ffecaeffffdeffffffffffffffffe5ffeba7ffffffffffa7ffffffa5742cffe98af3c27affffffffffffffffffffe9ffffffdcffffbcffef90ecc794ffffccebdbcae9ddd2"
+          "c3bcbafffff8ffffefffffffffd17affffffffffd4fffff9ebb360ffffffffffccffffffffffbcffffe6fffffaffffe7ffffe6fff4cbffffddffffccb0926bc29149",
+          "26414836414a3d414a2d414a2d414a17304340414a1c314a32414a23334a42414a36414a36404a2b324a42414a1e214a1c1c4a3b3a4a42414a312e4a26234a733d8d8e3eaf8e3caf741daf39146d42414a261b4a2d204a2d1f4a42414a42364a"
+          "42364a423a4a423f4a422e4a423a4a42414a423a4a42364a42304a42384a42414a42414a42334a423f4a34133a42384a42324a422c4a42384a42324a42384a422a4942334a423a4a422e49423a4a422a4442203842384a42384a42384a42414a"
+          "423d4a42243642384942414a422c3b42414a42414a733d8d8e3eaf8e35a68e15865c3d6842343b422c31423d4142414a423335423c3d421c1b42414142393742414342322d42413f42413d423d3542414a42413942414642414a42414a424137"
+          "424143424135424148423f2c42413342413742414a42414a42414342414842412c42413042413942412f42414142414642413f42413742413742414a42414337412340412f424143354128733f818e3eab8e3eab8e3ea45c406b3c413d39413b"
+          "42414a42414a1f41283d41472e41392b41363641432541330d411c2b413b39414a42414a40414a2d414134414a28413e39414a42414a3b414a3d414a42414a2b4149" } },
+    { "solid", 600, 0xdb696f45, {
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03",
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03",
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03",
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03"
+          "ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03ab6b03" } },
+    { "breathing", 600, 0x10cdd73d, {
+          "1e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e1300"
+          "1e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e1300"
+          "1e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e1300"
+          "1e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e1300"
+          "1e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e1300"
+          "1e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e1300"
+          "1e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e1300"
+          "1e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e1300"
+          "1e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e1300"
+          "1e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e1300"
+          "1e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e1300"
+          "1e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e1300"
+          "1e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e1300"
+          "1e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e1300"
+          "1e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e1300"
+          "1e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e1300"
+          "1e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e1300"
+          "1e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e1300"
+          "1e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e13001e1300",
+          "472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01"
+          "472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01"
+          "472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01"
+          "472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01"
+          "472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01"
+          "472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01"
+          "472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01"
+          "472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01"
+          "472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01"
+          "472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01"
+          "472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01"
+          "472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01"
+          "472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01"
+          "472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01"
+          "472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01"
+          "472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01"
+          "472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01"
+          "472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01"
+          "472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01472c01",
+          "100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00"
+          "100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00"
+          "100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00"
+          "100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00"
+          "100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00"
+          "100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00"
+          "100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00"
+          "100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00"
+          "100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00"
+          "100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00"
+          "100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00"
+          "100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00"
+          "100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00"
+          "100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00"
+          "100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00"
+          "100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00"
+          "100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00"
+          "100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00"
+          "100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00100a00",
+          "613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01"
+          "613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01"
+          "613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01"
+          "613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01"
+          "613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01"
+          "613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01"
+          "613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01"
+          "613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01"
+          "613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01"
+          "613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01"
+          "613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01"
+          "613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01"
+          "613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01"
+          "613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01"
+          "613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01"
+          "613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01"
+          "613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01"
+          "613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01"
+          "613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01613d01" } },
+    { "gradient", 600, 0x339512c5, {
+          "ab6b03ab6b03ab6b03a96702a96702a86602a86602a86602a66302a66302a66302a66302a55f02a55f02a55f02a56003a56003a35c03a35c03a35c03a35c03a35c03a25903a25903a15903a159039f55039f55039f55039f55039f55039e5203"
+          "9e52039d51039d51039d51039b4e039b4e039b4f049b4f049b4d049b4d049b4d049a4c049a4c049c49049c49049c49049c49049c49049d46049d46049b45049b45049b45049c43049c43049c43049c43049d40049d40049d40049b40059b4005"
+          "9d3d059d3d059d3d059d3d059d3d059d3b059d3b059c3a049c3a049d37049d37049d37049d37049d37049e34049e34049c34049c34049c34049e32049e32049d33059d33059e30059e30059e30059d2f059d2f059f2d059f2d059d2d059d2d05"
+          "9d2d059e2b059e2b059c2a059c2a059c2a059f29069f29069d28069d28069e26069e26069e26069d26059d26059e24059e24059d24059d24059d24059d21059d21059c21059c21059e1f069e1f069e1f069d1f069d1f069d1d069d1d069c1c06"
+          "9c1c069c1c069d1b069d1b069c1b069c1b069c19069c19069c19069b19069b19069d17069d17069c17069c17069c17069b16069b16069a16069a16069c14079c14079c14079a14079a14079814079814079814079a12079a1207991207991207"
+          "991007991007991007971006971006990e06990e06980f07980f07980f07980d07980d07970c07970c07980b07980b07980b07960b07960b07970a07970a07950a07950a07950a07970807970807960807960807950707950707950707940808"
+          "9408089308089308089108089108089108088e070a8e070a8c070a8c070a8c070a8a080c8a080c89080c89080c86080d86080d86080d85080d85080d84080e84080e82080f82080f82080f8008108008107e08107e08107d08107d08107d0810"
+          "7c08107c08107908127908127908127908127908127608137608137408137408137308147308147308147309157309157108157108156f08156f08156f08156c08166c08166c08166c08166b09186b09186b0918690817690817670818670818"
+          "67081867081867081864081964081963091963091963091961091a61091a61091a61091a5e081b5e081b5e081b5e081a5e081a5c091c5c091c5c091c5c091c5c091c59091c59091c58081c58081c56081d56081d56081d56091d56091d54091e"
+          "54091e53091d53091d53091d51081e51081e51081e51081e50091f50091f50091f4f091f4f091f4f091f4f091f4f091f4c09204c09204c091f4c091f4a09204a09204a09204a09204a0920480920480920470920470920470920450920450920"
+          "4509214509214309214309214309214309214309214109214109214109214109214109213f09223f09223e09213e09213d09223d09223d09223d09223d09223c09223c09223b09223b09223b09223a09223a09223a09223a09223a0922380923"
+          "3809233709223709223509233509233509233509233509233408233408233409223409223409223209233209233209233209233109233109233109233009233009232f08232f08232f08232f08232f08232e09232e09232d09232d09232c0924"
+          "2c09242c09242c09232c09232b09232b09232a09232a09232a09232a09232a0923290923290923280823280823280823270823270823270923270923270923260823260823250823250823240822240822240822240823240823230822230822"
+          "2208222208222208222208222208222108222108222008222008222008221f08221f08221f08211f08211e08221e08221e08221e08211e08211d08211d08211d08211d08211d08211c08211c08211c08201c08201b08201b08201b08201a0720"
+          "1a07201a08201a08201a08201a08201a082019082019082019082019082019082018081f18081f18081f18081f17071f17071f17071f17071f17071f16071e16071e15071e15071e15071e15071e15071e15071f15071f14071e14071e14071e"
+          "14071e14071e13071d13071d13071d13071d13071d13071d13071d12071d12071d12071c12071c12071c12071d12071d11071c11071c11071b11071b11071b11071b11071b10071c10071c10071c10071b10071b0f071b0f071b0f061a0f061a"
+          "0f061a0f061a0f061a0f061a0f061a0e061a0e061a0e061a0d06190d06190d06190d06190d06180d06180d06180d06190d06190d06190d06190c06180c06180c06180c06170c06170b06180b06180b06180b06180b06180b06170b06170b0616"
+          "0b06160a06170a06170a06170a06170a06170a05160a05160a05160a05160a0516090515090515090515090515090515090515090515090515090515080514080514080514080514080514080513080513080513080513080513070513070513"
+          "070513070513070513070513070513070512070512070512070512070512070512070512060411060411060412060412060411060411060411060411060411060411060411060411",
+          "ab6b03ab6b03ab6b03a96702a96702a86602a86602a86602a66302a66302a66302a66302a55f02a55f02a55f02a56003a56003a35c03a35c03a35c03a35c03a35c03a25903a25903a15903a159039f55039f55039f55039f55039f55039e5203"
+          "9e52039d51039d51039d51039b4e039b4e039b4f049b4f049b4d049b4d049b4d049a4c049a4c049c49049c49049c49049c49049c49049d46049d46049b45049b45049b45049c43049c43049c43049c43049d40049d40049d40049b40059b4005"
+          "9d3d059d3d059d3d059d3d059d3d059d3b059d3b059c3a049c3a049d37049d37049d37049d37049d37049e34049e34049c34049c34049c34049e32049e32049d33059d33059e30059e30059e30059d2f059d2f059f2d059f2d059d2d059d2d05"
+          "9d2d059e2b059e2b059c2a059c2a059c2a059f29069f29069d28069d28069e26069e26069e26069d26059d26059e24059e24059d24059d24059d24059d21059d21059c21059c21059e1f069e1f069e1f069d1f069d1f069d1d069d1d069c1c06"
+          "9c1c069c1c069d1b069d1b069c1b069c1b069c19069c19069c19069b19069b19069d17069d17069c17069c17069c17069b16069b16069a16069a16069c14079c14079c14079a14079a14079814079814079814079a12079a1207991207991207"
+          "991007991007991007971006971006990e06990e06980f07980f07980f07980d07980d07970c07970c07980b07980b07980b07960b07960b07970a07970a07950a07950a07950a07970807970807960807960807950707950707950707940808"
+          "9408089308089308089108089108089108088e070a8e070a8c070a8c070a8c070a8a080c8a080c89080c89080c86080d86080d86080d85080d85080d84080e84080e82080f82080f82080f8008108008107e08107e08107d08107d08107d0810"
+          "7c08107c08107908127908127908127908127908127608137608137408137408137308147308147308147309157309157108157108156f08156f08156f08156c08166c08166c08166c08166b09186b09186b0918690817690817670818670818"
+          "67081867081867081864081964081963091963091963091961091a61091a61091a61091a5e081b5e081b5e081b5e081a5e081a5c091c5c091c5c091c5c091c5c091c59091c59091c58081c58081c56081d56081d56081d56091d56091d54091e"
+          "54091e53091d53091d53091d51081e51081e51081e51081e50091f50091f50091f4f091f4f091f4f091f4f091f4f091f4c09204c09204c091f4c091f4a09204a09204a09204a09204a0920480920480920470920470920470920450920450920"
+          "4509214509214309214309214309214309214309214109214109214109214109214109213f09223f09223e09213e09213d09223d09223d09223d09223d09223c09223c09223b09223b09223b09223a09223a09223a09223a09223a0922380923"
+          "3809233709223709223509233509233509233509233509233408233408233409223409223409223209233209233209233209233109233109233109233009233009232f08232f08232f08232f08232f08232e09232e09232d09232d09232c0924"
+          "2c09242c09242c09232c09232b09232b09232a09232a09232a09232a09232a0923290923290923280823280823280823270823270823270923270923270923260823260823250823250823240822240822240822240823240823230822230822"
+          "2208222208222208222208222208222108222108222008222008222008221f08221f08221f08211f08211e08221e08221e08221e08211e08211d08211d08211d08211d08211d08211c08211c08211c08201c08201b08201b08201b08201a0720"
+          "1a07201a08201a08201a08201a08201a082019082019082019082019082019082018081f18081f18081f18081f17071f17071f17071f17071f17071f16071e16071e15071e15071e15071e15071e15071e15071f15071f14071e14071e14071e"
+          "14071e14071e13071d13071d13071d13071d13071d13071d13071d12071d12071d12071c12071c12071c12071d12071d11071c11071c11071b11071b11071b11071b11071b10071c10071c10071c10071b10071b0f071b0f071b0f061a0f061a"
+          "0f061a0f061a0f061a0f061a0f061a0e061a0e061a0e061a0d06190d06190d06190d06190d06180d06180d06180d06190d06190d06190d06190c06180c06180c06180c06170c06170b06180b06180b06180b06180b06180b06170b06170b0616"
+          "0b06160a06170a06170a06170a06170a06170a05160a05160a05160a05160a0516090515090515090515090515090515090515090515090515090515080514080514080514080514080514080513080513080513080513080513070513070513"
+          "070513070513070513070513070513070512070512070512070512070512070512070512060411060411060412060412060411060411060411060411060411060411060411060411",
+          "ab6b03ab6b03ab6b03a96702a96702a86602a86602a86602a66302a66302a66302a66302a55f02a55f02a55f02a56003a56003a35c03a35c03a35c03a35c03a35c03a25903a25903a15903a159039f55039f55039f55039f55039f55039e5203"
+          "9e52039d51039d51039d51039b4e039b4e039b4f049b4f049b4d049b4d049b4d049a4c049a4c049c49049c49049c49049c49049c49049d46049d46049b45049b45049b45049c43049c43049c43049c43049d40049d40049d40049b40059b4005"
+          "9d3d059d3d059d3d059d3d059d3d059d3b059d3b059c3a049c3a049d37049d37049d37049d37049d37049e34049e34049c34049c34049c34049e32049e32049d33059d33059e30059e30059e30059d2f059d2f059f2d059f2d059d2d059d2d05"
+          "9d2d059e2b059e2b059c2a059c2a059c2a059f29069f29069d28069d28069e26069e26069e26069d26059d26059e24059e24059d24059d24059d24059d21059d21059c21059c21059e1f069e1f069e1f069d1f069d1f069d1d069d1d069c1c06"
+          "9c1c069c1c069d1b069d1b069c1b069c1b069c19069c19069c19069b19069b19069d17069d17069c17069c17069c17069b16069b16069a16069a16069c14079c14079c14079a14079a14079814079814079814079a12079a1207991207991207"
+          "991007991007991007971006971006990e06990e06980f07980f07980f07980d07980d07970c07970c07980b07980b07980b07960b07960b07970a07970a07950a07950a07950a07970807970807960807960807950707950707950707940808"
+          "9408089308089308089108089108089108088e070a8e070a8c070a8c070a8c070a8a080c8a080c89080c89080c86080d86080d86080d85080d85080d84080e84080e82080f82080f82080f8008108008107e08107e08107d08107d08107d0810"
+          "7c08107c08107908127908127908127908127908127608137608137408137408137308147308147308147309157309157108157108156f08156f08156f08156c08166c08166c08166c08166b09186b09186b0918690817690817670818670818"
+          "67081867081867081864081964081963091963091963091961091a61091a61091a61091a5e081b5e081b5e081b5e081a5e081a5c091c5c091c5c091c5c091c5c091c59091c59091c58081c58081c56081d56081d56081d56091d56091d54091e"
+          "54091e53091d53091d53091d51081e51081e51081e51081e50091f50091f50091f4f091f4f091f4f091f4f091f4f091f4c09204c09204c091f4c091f4a09204a09204a09204a09204a0920480920480920470920470920470920450920450920"
+          "4509214509214309214309214309214309214309214109214109214109214109214109213f09223f09223e09213e09213d09223d09223d09223d09223d09223c09223c09223b09223b09223b09223a09223a09223a09223a09223a0922380923"
+          "3809233709223709223509233509233509233509233509233408233408233409223409223409223209233209233209233209233109233109233109233009233009232f08232f08232f08232f08232f08232e09232e09232d09232d09232c0924"
+          "2c09242c09242c09232c09232b09232b09232a09232a09232a09232a09232a0923290923290923280823280823280823270823270823270923270923270923260823260823250823250823240822240822240822240823240823230822230822"
+          "2208222208222208222208222208222108222108222008222008222008221f08221f08221f08211f08211e08221e08221e08221e08211e08211d08211d08211d08211d08211d08211c08211c08211c08201c08201b08201b08201b08201a0720"
+          "1a07201a08201a08201a08201a08201a082019082019082019082019082019082018081f18081f18081f18081f17071f17071f17071f17071f17071f16071e16071e15071e15071e15071e15071e15071e15071f15071f14071e14071e14071e"
+          "14071e14071e13071d13071d13071d13071d13071d13071d13071d12071d12071d12071c12071c12071c12071d12071d11071c11071c11071b11071b11071b11071b11071b10071c10071c10071c10071b10071b0f071b0f071b0f061a0f061a"
+          "0f061a0f061a0f061a0f061a0f061a0e061a0e061a0e061a0d06190d06190d06190d06190d06180d06180d06180d06190d06190d06190d06190c06180c06180c06180c06170c06170b06180b06180b06180b06180b06180b06170b06170b0616"
+          "0b06160a06170a06170a06170a06170a06170a05160a05160a05160a05160a0516090515090515090515090515090515090515090515090515090515080514080514080514080514080514080513080513080513080513080513070513070513"
+          "070513070513070513070513070513070512070512070512070512070512070512070512060411060411060412060412060411060411060411060411060411060411060411060411",
+          "ab6b03ab6b03ab6b03a96702a96702a86602a86602a86602a66302a66302a66302a66302a55f02a55f02a55f02a56003a56003a35c03a35c03a35c03a35c03a35c03a25903a25903a15903a159039f55039f55039f55039f55039f55039e5203"
+          "9e52039d51039d51039d51039b4e039b4e039b4f049b4f049b4d049b4d049b4d049a4c049a4c049c49049c49049c49049c49049c49049d46049d46049b45049b45049b45049c43049c43049c43049c43049d40049d40049d40049b40059b4005"
+          "9d3d059d3d059d3d059d3d059d3d059d3b059d3b059c3a049c3a049d37049d37049d37049d37049d37049e34049e34049c34049c34049c34049e32049e32049d33059d33059e30059e30059e30059d2f059d2f059f2d059f2d059d2d059d2d05"
+          "9d2d059e2b059e2b059c2a059c2a059c2a059f29069f29069d28069d28069e26069e26069e26069d26059d26059e24059e24059d24059d24059d24059d21059d21059c21059c21059e1f069e1f069e1f069d1f069d1f069d1d069d1d069c1c06"
+          "9c1c069c1c069d1b069d1b069c1b069c1b069c19069c19069c19069b19069b19069d17069d17069c17069c17069c17069b16069b16069a16069a16069c14079c14079c14079a14079a14079814079814079814079a12079a1207991207991207"
+          "991007991007991007971006971006990e06990e06980f07980f07980f07980d07980d07970c07970c07980b07980b07980b07960b07960b07970a07970a07950a07950a07950a07970807970807960807960807950707950707950707940808"
+          "9408089308089308089108089108089108088e070a8e070a8c070a8c070a8c070a8a080c8a080c89080c89080c86080d86080d86080d85080d85080d84080e84080e82080f82080f82080f8008108008107e08107e08107d08107d08107d0810"
+          "7c08107c08107908127908127908127908127908127608137608137408137408137308147308147308147309157309157108157108156f08156f08156f08156c08166c08166c08166c08166b09186b09186b0918690817690817670818670818"
+          "67081867081867081864081964081963091963091963091961091a61091a61091a61091a5e081b5e081b5e081b5e081a5e081a5c091c5c091c5c091c5c091c5c091c59091c59091c58081c58081c56081d56081d56081d56091d56091d54091e"
+          "54091e53091d53091d53091d51081e51081e51081e51081e50091f50091f50091f4f091f4f091f4f091f4f091f4f091f4c09204c09204c091f4c091f4a09204a09204a09204a09204a0920480920480920470920470920470920450920450920"
+          "4509214509214309214309214309214309214309214109214109214109214109214109213f09223f09223e09213e09213d09223d09223d09223d09223d09223c09223c09223b09223b09223b09223a09223a09223a09223a09223a0922380923"
+          "3809233709223709223509233509233509233509233509233408233408233409223409223409223209233209233209233209233109233109233109233009233009232f08232f08232f08232f08232f08232e09232e09232d09232d09232c0924"
+          "2c09242c09242c09232c09232b09232b09232a09232a09232a09232a09232a0923290923290923280823280823280823270823270823270923270923270923260823260823250823250823240822240822240822240823240823230822230822"
+          "2208222208222208222208222208222108222108222008222008222008221f08221f08221f08211f08211e08221e08221e08221e08211e08211d08211d08211d08211d08211d08211c08211c08211c08201c08201b08201b08201b08201a0720"
+          "1a07201a08201a08201a08201a08201a082019082019082019082019082019082018081f18081f18081f18081f17071f17071f17071f17071f17071f16071e16071e15071e15071e15071e15071e15071e15071f15071f14071e14071e14071e"
+          "14071e14071e13071d13071d13071d13071d13071d13071d13071d12071d12071d12071c12071c12071c12071d12071d11071c11071c11071b11071b11071b11071b11071b10071c10071c10071c10071b10071b0f071b0f071b0f061a0f061a"
+          "0f061a0f061a0f061a0f061a0f061a0e061a0e061a0e061a0d06190d06190d06190d06190d06180d06180d06180d06190d06190d06190d06190c06180c06180c06180c06170c06170b06180b06180b06180b06180b06180b06170b06170b0616"
+          "0b06160a06170a06170a06170a06170a06170a05160a05160a05160a05160a0516090515090515090515090515090515090515090515090515090515080514080514080514080514080514080513080513080513080513080513070513070513"
+          "070513070513070513070513070513070512070512070512070512070512070512070512060411060411060412060412060411060411060411060411060411060411060411060411" } },
+    { "rainbow", 600, 0x040e8ead, {
+          "01966a01966a01966a01916f01916f018b75018b75018b7501867a01867a01817f01817f017b85017b85017b8501768a01768a01718f01718f016b95016b95016b9501669a01669a01619f01619f01619f015ba5015ba50156aa0156aa0151af"
+          "0151af0151af014bb5014bb50146ba0146ba0141bf0141bf0141bf013bc5013bc50136ca0136ca0136ca0131cf0131cf012bd5012bd50126da0126da0126da0121df0121df011be5011be50116ea0116ea0116ea0111ef0111ef010bf5010bf5"
+          "0106fa0106fa0106fa0101ff0101ff0201fd0201fd0201fd0501fa0501fa0801f70801f70a01f50a01f50a01f50d01f20d01f21001ef1001ef1201ed1201ed1201ed1501ea1501ea1801e71801e71801e71a01e51a01e51d01e21d01e22001df"
+          "2001df2001df2201dd2201dd2501da2501da2801d72801d72801d72b01d42b01d42d01d22d01d22d01d23001cf3001cf3301cc3301cc3501ca3501ca3501ca3801c73801c73b01c43b01c43d01c23d01c23d01c24001bf4001bf4301bc4301bc"
+          "4501ba4501ba4501ba4801b74801b74b01b44b01b44b01b44d01b24d01b25001af5001af5301ac5301ac5301ac5501ab5501ab5701a95701a95a01a65a01a65a01a65d01a35d01a35f01a15f01a15f01a162019e62019e65019b65019b670199"
+          "6701996701996a01966a01966d01936d01936f01916f01916f019172018e72018e75018b75018b75018b7701897701897a01867a01867d01837d01837d018380018080018082017e82017e85017b85017b85017b8801788801788a01768a0176"
+          "8d01738d01738d017390017090017092016e92016e92016e95016b95016b9801689801689a01669a01669a01669d01639d0163a00160a00160a2015ea2015ea2015ea5015ba5015ba80158a80158a80158aa0155aa0155ac0153ac0153af0150"
+          "af0150af0150b2014db2014db4014bb4014bb70148b70148b70148ba0145ba0145bc0143bc0143bc0143bf0140bf0140c2013dc2013dc4013bc4013bc4013bc70138c70138ca0135ca0135cc0133cc0133cc0133cf0130cf0130d2012dd2012d"
+          "d5012ad5012ad5012ad70128d70128da0125da0125da0125dd0122dd0122df0120df0120e2011de2011de2011de5011ae5011ae70118e70118ea0115ea0115ea0115ed0112ed0112ef0110ef0110ef0110f2010df2010df5010af5010af70108"
+          "f70108f70108fa0105fa0105fd0102fd0102ff0101ff0101ff0101fd0201fd0201fa0501fa0501fa0501f70801f70801f50a01f50a01f20d01f20d01f20d01ef1001ef1001ed1201ed1201ea1501ea1501ea1501e71801e71801e51a01e51a01"
+          "e21d01e21d01e21d01df2001df2001dd2201dd2201dd2201da2501da2501d72801d72801d42b01d42b01d42b01d22d01d22d01cf3001cf3001cc3301cc3301cc3301ca3501ca3501c73801c73801c73801c43b01c43b01c23d01c23d01bf4001"
+          "bf4001bf4001bc4301bc4301ba4501ba4501b74801b74801b74801b44b01b44b01b24d01b24d01b24d01af5001af5001ac5301ac5301ab5501ab5501ab5501ab5701ab5701ab5a01ab5a01ab5d01ab5d01ab5d01ab5f01ab5f01ab6201ab6201"
+          "ab6501ab6501ab6501ab6701ab6701ab6a01ab6a01ab6a01ab6d01ab6d01ab6f01ab6f01ab7201ab7201ab7201ab7501ab7501ab7701ab7701ab7a01ab7a01ab7a01ab7d01ab7d01ab8001ab8001ab8001ab8201ab8201ab8501ab8501ab8801"
+          "ab8801ab8801ab8a01ab8a01ab8d01ab8d01ab9001ab9001ab9001ab9201ab9201ab9501ab9501ab9501ab9801ab9801ab9a01ab9a01ab9d01ab9d01ab9d01aba001aba001aba201aba201aba501aba501aba501aba801aba801abaa01abaa01"
+          "a6ac01a6ac01a6ac01a1af01a1af019bb2019bb2019bb20196b40196b40191b70191b7018bba018bba018bba0186bc0186bc0181bf0181bf017bc2017bc2017bc20176c40176c40171c70171c70171c7016bca016bca0166cc0166cc0161cf01"
+          "61cf0161cf015bd2015bd20156d50156d50151d70151d70151d7014bda014bda0146dd0146dd0146dd0141df0141df013be2013be20136e50136e50136e50131e70131e7012bea012bea0126ed0126ed0126ed0121ef0121ef011bf2011bf201"
+          "16f50116f50116f50111f70111f7010bfa010bfa010bfa0106fd0106fd0101ff0101ff0101fd0201fd0201fd0201fa0501fa0501f70801f70801f50a01f50a01f50a01f20d01f20d01ef1001ef1001ef1001ed1201ed1201ea1501ea1501e718"
+          "01e71801e71801e51a01e51a01e21d01e21d01df2001df2001df2001dd2201dd2201da2501da2501da2501d72801d72801d42b01d42b01d22d01d22d01d22d01cf3001cf3001cc3301cc3301ca3501ca3501ca3501c73801c73801c43b01c43b"
+          "01c23d01c23d01c23d01bf4001bf4001bc4301bc4301bc4301ba4501ba4501b74801b74801b44b01b44b01b44b01b24d01b24d01af5001af5001ac5301ac5301ac5301ab5501ab55",
+          "ea1501ea1501ea1501e71801e71801e51a01e51a01e51a01e21d01e21d01df2001df2001dd2201dd2201dd2201da2501da2501d72801d72801d42b01d42b01d42b01d22d01d22d01cf3001cf3001cf3001cc3301cc3301ca3501ca3501c73801"
+          "c73801c73801c43b01c43b01c23d01c23d01bf4001bf4001bf4001bc4301bc4301ba4501ba4501ba4501b74801b74801b44b01b44b01b24d01b24d01b24d01af5001af5001ac5301ac5301ab5501ab5501ab5501ab5701ab5701ab5a01ab5a01"
+          "ab5d01ab5d01ab5d01ab5f01ab5f01ab6201ab6201ab6201ab6501ab6501ab6701ab6701ab6a01ab6a01ab6a01ab6d01ab6d01ab6f01ab6f01ab7201ab7201ab7201ab7501ab7501ab7701ab7701ab7701ab7a01ab7a01ab7d01ab7d01ab8001"
+          "ab8001ab8001ab8201ab8201ab8501ab8501ab8801ab8801ab8801ab8a01ab8a01ab8d01ab8d01ab8d01ab9001ab9001ab9201ab9201ab9501ab9501ab9501ab9801ab9801ab9a01ab9a01ab9d01ab9d01ab9d01aba001aba001aba201aba201"
+          "aba501aba501aba501aba801aba801abaa01abaa01abaa01a6ac01a6ac01a1af01a1af019bb2019bb2019bb20196b40196b40191b70191b7018bba018bba018bba0186bc0186bc0181bf0181bf0181bf017bc2017bc20176c40176c40171c701"
+          "71c70171c7016bca016bca0166cc0166cc0161cf0161cf0161cf015bd2015bd20156d50156d50156d50151d70151d7014bda014bda0146dd0146dd0146dd0141df0141df013be2013be20136e50136e50136e50131e70131e7012bea012bea01"
+          "26ed0126ed0126ed0121ef0121ef011bf2011bf2011bf20116f50116f50111f70111f7010bfa010bfa010bfa0106fd0106fd0101ff0101ff0101fd0201fd0201fd0201fa0501fa0501f70801f70801f70801f50a01f50a01f20d01f20d01ef10"
+          "01ef1001ef1001ed1201ed1201ea1501ea1501e71801e71801e71801e51a01e51a01e21d01e21d01e21d01df2001df2001dd2201dd2201da2501da2501da2501d72801d72801d42b01d42b01d22d01d22d01d22d01cf3001cf3001cc3301cc33"
+          "01ca3501ca3501ca3501c73801c73801c43b01c43b01c43b01c23d01c23d01bf4001bf4001bc4301bc4301bc4301ba4501ba4501b74801b74801b44b01b44b01b44b01b24d01b24d01af5001af5001af5001ac5301ac5301ab5501ab5501a65a"
+          "01a65a01a65a01a15f01a15f019b65019b6501966a01966a01966a01916f01916f018b75018b75018b7501867a01867a01817f01817f017b85017b85017b8501768a01768a01718f01718f016b95016b95016b9501669a01669a01619f01619f"
+          "015ba5015ba5015ba50156aa0156aa0151af0151af0151af014bb5014bb50146ba0146ba0141bf0141bf0141bf013bc5013bc50136ca0136ca0131cf0131cf0131cf012bd5012bd50126da0126da0126da0121df0121df011be5011be50116ea"
+          "0116ea0116ea0111ef0111ef010bf5010bf50106fa0106fa0106fa0101ff0101ff0201fd0201fd0201fd0501fa0501fa0801f70801f70a01f50a01f50a01f50d01f20d01f21001ef1001ef1201ed1201ed1201ed1501ea1501ea1801e71801e7"
+          "1a01e51a01e51a01e51d01e21d01e22001df2001df2001df2201dd2201dd2501da2501da2801d72801d72801d72b01d42b01d42d01d22d01d23001cf3001cf3001cf3301cc3301cc3501ca3501ca3501ca3801c73801c73b01c43b01c43d01c2"
+          "3d01c23d01c24001bf4001bf4301bc4301bc4501ba4501ba4501ba4801b74801b74b01b44b01b44b01b44d01b24d01b25001af5001af5301ac5301ac5301ac5501ab5501ab5701a95701a95a01a65a01a65a01a65d01a35d01a35f01a15f01a1"
+          "62019e62019e62019e65019b65019b6701996701996701996a01966a01966d01936d01936f01916f01916f019172018e72018e75018b75018b7701897701897701897a01867a01867d01837d01837d018380018080018082017e82017e85017b"
+          "85017b85017b8801788801788a01768a01768d01738d01738d017390017090017092016e92016e92016e95016b95016b9801689801689a01669a01669a01669d01639d0163a00160a00160a2015ea2015ea2015ea5015ba5015ba80158a80158"
+          "aa0155aa0155aa0155ac0153ac0153af0150af0150af0150b2014db2014db4014bb4014bb70148b70148b70148ba0145ba0145bc0143bc0143bf0140bf0140bf0140c2013dc2013dc4013bc4013bc4013bc70138c70138ca0135ca0135cc0133"
+          "cc0133cc0133cf0130cf0130d2012dd2012dd5012ad5012ad5012ad70128d70128da0125da0125da0125dd0122dd0122df0120df0120e2011de2011de2011de5011ae5011ae70118e70118ea0115ea0115ea0115ed0112ed0112ef0110ef0110"
+          "f2010df2010df2010df5010af5010af70108f70108f70108fa0105fa0105fd0102fd0102ff0101ff0101ff0101fd0201fd0201fa0501fa0501f70801f70801f70801f50a01f50a01",
+          "016b95016b95016b9501669a01669a01619f01619f01619f015ba5015ba50156aa0156aa0151af0151af0151af014bb5014bb50146ba0146ba0141bf0141bf0141bf013bc5013bc50136ca0136ca0136ca0131cf0131cf012bd5012bd50126da"
+          "0126da0126da0121df0121df011be5011be50116ea0116ea0116ea0111ef0111ef010bf5010bf5010bf50106fa0106fa0101ff0101ff0201fd0201fd0201fd0501fa0501fa0801f70801f70a01f50a01f50a01f50d01f20d01f21001ef1001ef"
+          "1201ed1201ed1201ed1501ea1501ea1801e71801e71801e71a01e51a01e51d01e21d01e22001df2001df2001df2201dd2201dd2501da2501da2801d72801d72801d72b01d42b01d42d01d22d01d22d01d23001cf3001cf3301cc3301cc3501ca"
+          "3501ca3501ca3801c73801c73b01c43b01c43d01c23d01c23d01c24001bf4001bf4301bc4301bc4301bc4501ba4501ba4801b74801b74b01b44b01b44b01b44d01b24d01b25001af5001af5301ac5301ac5301ac5501ab5501ab5701a95701a9"
+          "5a01a65a01a65a01a65d01a35d01a35f01a15f01a15f01a162019e62019e65019b65019b6701996701996701996a01966a01966d01936d01936f01916f01916f019172018e72018e75018b75018b75018b7701897701897a01867a01867d0183"
+          "7d01837d018380018080018082017e82017e85017b85017b85017b8801788801788a01768a01768a01768d01738d017390017090017092016e92016e92016e95016b95016b9801689801689a01669a01669a01669d01639d0163a00160a00160"
+          "a2015ea2015ea2015ea5015ba5015ba80158a80158a80158aa0155aa0155ac0153ac0153af0150af0150af0150b2014db2014db4014bb4014bb70148b70148b70148ba0145ba0145bc0143bc0143bc0143bf0140bf0140c2013dc2013dc4013b"
+          "c4013bc4013bc70138c70138ca0135ca0135cc0133cc0133cc0133cf0130cf0130d2012dd2012dd2012dd5012ad5012ad70128d70128da0125da0125da0125dd0122dd0122df0120df0120e2011de2011de2011de5011ae5011ae70118e70118"
+          "ea0115ea0115ea0115ed0112ed0112ef0110ef0110ef0110f2010df2010df5010af5010af70108f70108f70108fa0105fa0105fd0102fd0102ff0101ff0101ff0101fd0201fd0201fa0501fa0501fa0501f70801f70801f50a01f50a01f20d01"
+          "f20d01f20d01ef1001ef1001ed1201ed1201ea1501ea1501ea1501e71801e71801e51a01e51a01e51a01e21d01e21d01df2001df2001dd2201dd2201dd2201da2501da2501d72801d72801d42b01d42b01d42b01d22d01d22d01cf3001cf3001"
+          "cc3301cc3301cc3301ca3501ca3501c73801c73801c73801c43b01c43b01c23d01c23d01bf4001bf4001bf4001bc4301bc4301ba4501ba4501b74801b74801b74801b44b01b44b01b24d01b24d01b24d01af5001af5001ac5301ac5301ab5501"
+          "ab5501ab5501ab5701ab5701ab5a01ab5a01ab5d01ab5d01ab5d01ab5f01ab5f01ab6201ab6201ab6201ab6501ab6501ab6701ab6701ab6a01ab6a01ab6a01ab6d01ab6d01ab6f01ab6f01ab7201ab7201ab7201ab7501ab7501ab7701ab7701"
+          "ab7a01ab7a01ab7a01ab7d01ab7d01ab8001ab8001ab8001ab8201ab8201ab8501ab8501ab8801ab8801ab8801ab8a01ab8a01ab8d01ab8d01ab9001ab9001ab9001ab9201ab9201ab9501ab9501ab9501ab9801ab9801ab9a01ab9a01ab9d01"
+          "ab9d01ab9d01aba001aba001aba201aba201aba501aba501aba501aba801aba801abaa01abaa01abaa01a6ac01a6ac01a1af01a1af019bb2019bb2019bb20196b40196b40191b70191b7018bba018bba018bba0186bc0186bc0181bf0181bf01"
+          "7bc2017bc2017bc20176c40176c40171c70171c70171c7016bca016bca0166cc0166cc0161cf0161cf0161cf015bd2015bd20156d50156d50151d70151d70151d7014bda014bda0146dd0146dd0146dd0141df0141df013be2013be20136e501"
+          "36e50136e50131e70131e7012bea012bea0126ed0126ed0126ed0121ef0121ef011bf2011bf2011bf20116f50116f50111f70111f7010bfa010bfa010bfa0106fd0106fd0101ff0101ff0101fd0201fd0201fd0201fa0501fa0501f70801f708"
+          "01f50a01f50a01f50a01f20d01f20d01ef1001ef1001ef1001ed1201ed1201ea1501ea1501e71801e71801e71801e51a01e51a01e21d01e21d01df2001df2001df2001dd2201dd2201da2501da2501da2501d72801d72801d42b01d42b01d22d"
+          "01d22d01d22d01cf3001cf3001cc3301cc3301ca3501ca3501ca3501c73801c73801c43b01c43b01c43b01c23d01c23d01bf4001bf4001bc4301bc4301bc4301ba4501ba4501b74801b74801b44b01b44b01b44b01b24d01b24d01af5001af50"
+          "01ac5301ac5301ac5301ab5501ab5501a65a01a65a01a65a01a15f01a15f019b65019b6501966a01966a01966a01916f01916f018b75018b7501867a01867a01867a01817f01817f",
+          "d42b01d42b01d42b01d22d01d22d01cf3001cf3001cf3001cc3301cc3301ca3501ca3501c73801c73801c73801c43b01c43b01c23d01c23d01bf4001bf4001bf4001bc4301bc4301ba4501ba4501ba4501b74801b74801b44b01b44b01b24d01"
+          "b24d01b24d01af5001af5001ac5301ac5301ab5501ab5501ab5501ab5701ab5701ab5a01ab5a01ab5a01ab5d01ab5d01ab5f01ab5f01ab6201ab6201ab6201ab6501ab6501ab6701ab6701ab6a01ab6a01ab6a01ab6d01ab6d01ab6f01ab6f01"
+          "ab7201ab7201ab7201ab7501ab7501ab7701ab7701ab7701ab7a01ab7a01ab7d01ab7d01ab8001ab8001ab8001ab8201ab8201ab8501ab8501ab8801ab8801ab8801ab8a01ab8a01ab8d01ab8d01ab8d01ab9001ab9001ab9201ab9201ab9501"
+          "ab9501ab9501ab9801ab9801ab9a01ab9a01ab9d01ab9d01ab9d01aba001aba001aba201aba201aba201aba501aba501aba801aba801abaa01abaa01abaa01a6ac01a6ac01a1af01a1af019bb2019bb2019bb20196b40196b40191b70191b701"
+          "8bba018bba018bba0186bc0186bc0181bf0181bf0181bf017bc2017bc20176c40176c40171c70171c70171c7016bca016bca0166cc0166cc0161cf0161cf0161cf015bd2015bd20156d50156d50156d50151d70151d7014bda014bda0146dd01"
+          "46dd0146dd0141df0141df013be2013be20136e50136e50136e50131e70131e7012bea012bea012bea0126ed0126ed0121ef0121ef011bf2011bf2011bf20116f50116f50111f70111f7010bfa010bfa010bfa0106fd0106fd0101ff0101ff01"
+          "01fd0201fd0201fd0201fa0501fa0501f70801f70801f70801f50a01f50a01f20d01f20d01ef1001ef1001ef1001ed1201ed1201ea1501ea1501e71801e71801e71801e51a01e51a01e21d01e21d01e21d01df2001df2001dd2201dd2201da25"
+          "01da2501da2501d72801d72801d42b01d42b01d22d01d22d01d22d01cf3001cf3001cc3301cc3301cc3301ca3501ca3501c73801c73801c43b01c43b01c43b01c23d01c23d01bf4001bf4001bc4301bc4301bc4301ba4501ba4501b74801b748"
+          "01b44b01b44b01b44b01b24d01b24d01af5001af5001af5001ac5301ac5301ab5501ab5501a65a01a65a01a65a01a15f01a15f019b65019b6501966a01966a01966a01916f01916f018b75018b75018b7501867a01867a01817f01817f017b85"
+          "017b85017b8501768a01768a01718f01718f016b95016b95016b9501669a01669a01619f01619f01619f015ba5015ba50156aa0156aa0151af0151af0151af014bb5014bb50146ba0146ba0141bf0141bf0141bf013bc5013bc50136ca0136ca"
+          "0131cf0131cf0131cf012bd5012bd50126da0126da0126da0121df0121df011be5011be50116ea0116ea0116ea0111ef0111ef010bf5010bf50106fa0106fa0106fa0101ff0101ff0201fd0201fd0201fd0501fa0501fa0801f70801f70a01f5"
+          "0a01f50a01f50d01f20d01f21001ef1001ef1201ed1201ed1201ed1501ea1501ea1801e71801e71801e71a01e51a01e51d01e21d01e22001df2001df2001df2201dd2201dd2501da2501da2801d72801d72801d72b01d42b01d42d01d22d01d2"
+          "3001cf3001cf3001cf3301cc3301cc3501ca3501ca3501ca3801c73801c73b01c43b01c43d01c23d01c23d01c24001bf4001bf4301bc4301bc4501ba4501ba4501ba4801b74801b74b01b44b01b44b01b44d01b24d01b25001af5001af5301ac"
+          "5301ac5301ac5501ab5501ab5701a95701a95a01a65a01a65a01a65d01a35d01a35f01a15f01a15f01a162019e62019e65019b65019b6701996701996701996a01966a01966d01936d01936f01916f01916f019172018e72018e75018b75018b"
+          "7701897701897701897a01867a01867d01837d01837d018380018080018082017e82017e85017b85017b85017b8801788801788a01768a01768d01738d01738d017390017090017092016e92016e92016e95016b95016b9801689801689a0166"
+          "9a01669a01669d01639d0163a00160a00160a2015ea2015ea2015ea5015ba5015ba80158a80158a80158aa0155aa0155ac0153ac0153af0150af0150af0150b2014db2014db4014bb4014bb70148b70148b70148ba0145ba0145bc0143bc0143"
+          "bf0140bf0140bf0140c2013dc2013dc4013bc4013bc4013bc70138c70138ca0135ca0135cc0133cc0133cc0133cf0130cf0130d2012dd2012dd5012ad5012ad5012ad70128d70128da0125da0125da0125dd0122dd0122df0120df0120e2011d"
+          "e2011de2011de5011ae5011ae70118e70118ea0115ea0115ea0115ed0112ed0112ef0110ef0110ef0110f2010df2010df5010af5010af70108f70108f70108fa0105fa0105fd0102fd0102ff0101ff0101ff0101fd0201fd0201fa0501fa0501"
+          "f70801f70801f70801f50a01f50a01f20d01f20d01f20d01ef1001ef1001ed1201ed1201ea1501ea1501ea1501e71801e71801e51a01e51a01e21d01e21d01e21d01df2001df2001" } },
+    { "chase", 600, 0x2a9ea5da, {
+          "050410050410050410050410050410050410050410050410472d0aab6b03ab6b03ab6b03684107050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410",
+          "0504100504100504100504100504100504100504100504100504100504100504100504101e130dab6b03ab6b03ab6b03915b04050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410",
+          "0504100504100504100504100504100504100504100504100504100504100504100504100504100504100504100504100504109b6103ab6b03ab6b03ab6b03140d0e050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410",
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410714706ab6b03ab6b03ab6b033e270b050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410"
+          "050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410050410" } },
+    { "pulse", 600, 0x80ddd187, {
+          "1e1300321f00492d01633e017e4e02925b02a16502a96a02a26502965e028251026942014e3101362100221500120b000905000402000201000100000100000100000201000402000b0700150d002617003a24015435016e45018654029a6002"
+          "a46602a869029e63028e5902794c025e3a01442b012e1c001b11000e09000604000201000100000100000100000100000201000604000e09001b11002e1c00442b015e3a01794c028e59029e6302a86902a466029a60028654026e4501543501"
+          "3a2401261700150d000b0700040200020100010000010000010000020100040200090500120b002215003621004e3101694201825102965e02a26502a96a02a16502925b027e4e02633e01492d01321f001e1300100a00080500030200010000"
+          "0100000100000100000201000503000c0700180f002a1a003f27015938017448028956029d6202a56702a567029d62028956027448025938013f27012a1a00180f000c0700050300020100010000010000010000010000030200080500100a00"
+          "1e1300321f00492d01633e017e4e02925b02a16502a96a02a26502965e028251026942014e3101362100221500120b000905000402000201000100000100000100000201000402000b0700150d002617003a24015435016e45018654029a6002"
+          "a46602a869029e63028e5902794c025e3a01442b012e1c001b11000e09000604000201000100000100000100000100000201000604000e09001b11002e1c00442b015e3a01794c028e59029e6302a86902a466029a60028654026e4501543501"
+          "3a2401261700150d000b0700040200020100010000010000010000020100040200090500120b002215003621004e3101694201825102965e02a26502a96a02a16502925b027e4e02633e01492d01321f001e1300100a00080500030200010000"
+          "0100000100000100000201000503000c0700180f002a1a003f27015938017448028956029d6202a56702a567029d62028956027448025938013f27012a1a00180f000c0700050300020100010000010000010000010000030200080500100a00"
+          "1e1300321f00492d01633e017e4e02925b02a16502a96a02a26502965e028251026942014e3101362100221500120b000905000402000201000100000100000100000201000402000b0700150d002617003a24015435016e45018654029a6002"
+          "a46602a869029e63028e5902794c025e3a01442b012e1c001b11000e09000604000201000100000100000100000100000201000604000e09001b11002e1c00442b015e3a01794c028e59029e6302a86902a466029a60028654026e4501543501"
+          "3a2401261700150d000b0700040200020100010000010000010000020100040200090500120b002215003621004e3101694201825102965e02a26502a96a02a16502925b027e4e02633e01492d01321f001e1300100a00080500030200010000"
+          "0100000100000100000201000503000c0700180f002a1a003f27015938017448028956029d6202a56702a567029d62028956027448025938013f27012a1a00180f000c0700050300020100010000010000010000010000030200080500100a00"
+          "1e1300321f00492d01633e017e4e02925b02a16502a96a02a26502965e028251026942014e3101362100221500120b000905000402000201000100000100000100000201000402000b0700150d002617003a24015435016e45018654029a6002"
+          "a46602a869029e63028e5902794c025e3a01442b012e1c001b11000e09000604000201000100000100000100000100000201000604000e09001b11002e1c00442b015e3a01794c028e59029e6302a86902a466029a60028654026e4501543501"
+          "3a2401261700150d000b0700040200020100010000010000010000020100040200090500120b002215003621004e3101694201825102965e02a26502a96a02a16502925b027e4e02633e01492d01321f001e1300100a00080500030200010000"
+          "0100000100000100000201000503000c0700180f002a1a003f27015938017448028956029d6202a56702a567029d62028956027448025938013f27012a1a00180f000c0700050300020100010000010000010000010000030200080500100a00"
+          "1e1300321f00492d01633e017e4e02925b02a16502a96a02a26502965e028251026942014e3101362100221500120b000905000402000201000100000100000100000201000402000b0700150d002617003a24015435016e45018654029a6002"
+          "a46602a869029e63028e5902794c025e3a01442b012e1c001b11000e09000604000201000100000100000100000100000201000604000e09001b11002e1c00442b015e3a01794c028e59029e6302a86902a466029a60028654026e4501543501"
+          "3a2401261700150d000b0700040200020100010000010000010000020100040200090500120b002215003621004e3101694201825102965e02a26502a96a02a16502925b027e4e02",
+          "472c01301e001d12000f09000704000302000100000100000100000100000201000603000d08001a10002c1b004229015c39017649028c57029e6302a66802a567029d62028855027046015736013d2601281900170e000c0700040200020100"
+          "010000010000010000010000040200080500110a002014003420004c2f01663f01805002945d02a16502ab6b03a16502945d02805002663f014c2f01342000201400110a000805000402000100000100000100000100000201000402000c0700"
+          "170e002819003d26015736017046018855029d6202a56702a668029e63028c57027649025c39014229012c1b001a10000d08000603000201000100000100000100000100000302000704000f09001d1200301e00472c01613d017c4e028f5902"
+          "a06402a86902a46602985f028452026b4301523301382300241600140c000a06000402000201000100000100000100000201000402000a0600140c002416003823005233016b4301845202985f02a46602a86902a064028f59027c4e02613d01"
+          "472c01301e001d12000f09000704000302000100000100000100000100000201000603000d08001a10002c1b004229015c39017649028c57029e6302a66802a567029d62028855027046015736013d2601281900170e000c0700040200020100"
+          "010000010000010000010000040200080500110a002014003420004c2f01663f01805002945d02a16502ab6b03a16502945d02805002663f014c2f01342000201400110a000805000402000100000100000100000100000201000402000c0700"
+          "170e002819003d26015736017046018855029d6202a56702a668029e63028c57027649025c39014229012c1b001a10000d08000603000201000100000100000100000100000302000704000f09001d1200301e00472c01613d017c4e028f5902"
+          "a06402a86902a46602985f028452026b4301523301382300241600140c000a06000402000201000100000100000100000201000402000a0600140c002416003823005233016b4301845202985f02a46602a86902a064028f59027c4e02613d01"
+          "472c01301e001d12000f09000704000302000100000100000100000100000201000603000d08001a10002c1b004229015c39017649028c57029e6302a66802a567029d62028855027046015736013d2601281900170e000c0700040200020100"
+          "010000010000010000010000040200080500110a002014003420004c2f01663f01805002945d02a16502ab6b03a16502945d02805002663f014c2f01342000201400110a000805000402000100000100000100000100000201000402000c0700"
+          "170e002819003d26015736017046018855029d6202a56702a668029e63028c57027649025c39014229012c1b001a10000d08000603000201000100000100000100000100000302000704000f09001d1200301e00472c01613d017c4e028f5902"
+          "a06402a86902a46602985f028452026b4301523301382300241600140c000a06000402000201000100000100000100000201000402000a0600140c002416003823005233016b4301845202985f02a46602a86902a064028f59027c4e02613d01"
+          "472c01301e001d12000f09000704000302000100000100000100000100000201000603000d08001a10002c1b004229015c39017649028c57029e6302a66802a567029d62028855027046015736013d2601281900170e000c0700040200020100"
+          "010000010000010000010000040200080500110a002014003420004c2f01663f01805002945d02a16502ab6b03a16502945d02805002663f014c2f01342000201400110a000805000402000100000100000100000100000201000402000c0700"
+          "170e002819003d26015736017046018855029d6202a56702a668029e63028c57027649025c39014229012c1b001a10000d08000603000201000100000100000100000100000302000704000f09001d1200301e00472c01613d017c4e028f5902"
+          "a06402a86902a46602985f028452026b4301523301382300241600140c000a06000402000201000100000100000100000201000402000a0600140c002416003823005233016b4301845202985f02a46602a86902a064028f59027c4e02613d01"
+          "472c01301e001d12000f09000704000302000100000100000100000100000201000603000d08001a10002c1b004229015c39017649028c57029e6302a66802a567029d62028855027046015736013d2601281900170e000c0700040200020100"
+          "010000010000010000010000040200080500110a002014003420004c2f01663f01805002945d02a16502ab6b03a16502945d02805002663f014c2f01342000201400110a000805000402000100000100000100000100000201000402000c0700"
+          "170e002819003d26015736017046018855029d6202a56702a668029e63028c57027649025c39014229012c1b001a10000d0800060300020100010000010000010000010000030200",
+          "100a001e1300321f00492d01633e017e4e02925b02a16502a96a02a26502965e028251026942014e3101362100221500120b000905000402000201000100000100000100000201000402000b0700150d002617003a24015435016e4501865402"
+          "9a6002a46602a869029e63028e5902794c025e3a01442b012e1c001b11000e09000604000201000100000100000100000100000201000604000e09001b11002e1c00442b015e3a01794c028e59029e6302a86902a466029a60028654026e4501"
+          "5435013a2401261700150d000b0700040200020100010000010000010000020100040200090500120b002215003621004e3101694201825102965e02a26502a96a02a16502925b027e4e02633e01492d01321f001e1300100a00080500030200"
+          "0100000100000100000100000201000503000c0700180f002a1a003f27015938017448028956029d6202a56702a567029d62028956027448025938013f27012a1a00180f000c0700050300020100010000010000010000010000030200080500"
+          "100a001e1300321f00492d01633e017e4e02925b02a16502a96a02a26502965e028251026942014e3101362100221500120b000905000402000201000100000100000100000201000402000b0700150d002617003a24015435016e4501865402"
+          "9a6002a46602a869029e63028e5902794c025e3a01442b012e1c001b11000e09000604000201000100000100000100000100000201000604000e09001b11002e1c00442b015e3a01794c028e59029e6302a86902a466029a60028654026e4501"
+          "5435013a2401261700150d000b0700040200020100010000010000010000020100040200090500120b002215003621004e3101694201825102965e02a26502a96a02a16502925b027e4e02633e01492d01321f001e1300100a00080500030200"
+          "0100000100000100000100000201000503000c0700180f002a1a003f27015938017448028956029d6202a56702a567029d62028956027448025938013f27012a1a00180f000c0700050300020100010000010000010000010000030200080500"
+          "100a001e1300321f00492d01633e017e4e02925b02a16502a96a02a26502965e028251026942014e3101362100221500120b000905000402000201000100000100000100000201000402000b0700150d002617003a24015435016e4501865402"
+          "9a6002a46602a869029e63028e5902794c025e3a01442b012e1c001b11000e09000604000201000100000100000100000100000201000604000e09001b11002e1c00442b015e3a01794c028e59029e6302a86902a466029a60028654026e4501"
+          "5435013a2401261700150d000b0700040200020100010000010000010000020100040200090500120b002215003621004e3101694201825102965e02a26502a96a02a16502925b027e4e02633e01492d01321f001e1300100a00080500030200"
+          "0100000100000100000100000201000503000c0700180f002a1a003f27015938017448028956029d6202a56702a567029d62028956027448025938013f27012a1a00180f000c0700050300020100010000010000010000010000030200080500"
+          "100a001e1300321f00492d01633e017e4e02925b02a16502a96a02a26502965e028251026942014e3101362100221500120b000905000402000201000100000100000100000201000402000b0700150d002617003a24015435016e4501865402"
+          "9a6002a46602a869029e63028e5902794c025e3a01442b012e1c001b11000e09000604000201000100000100000100000100000201000604000e09001b11002e1c00442b015e3a01794c028e59029e6302a86902a466029a60028654026e4501"
+          "5435013a2401261700150d000b0700040200020100010000010000010000020100040200090500120b002215003621004e3101694201825102965e02a26502a96a02a16502925b027e4e02633e01492d01321f001e1300100a00080500030200"
+          "0100000100000100000100000201000503000c0700180f002a1a003f27015938017448028956029d6202a56702a567029d62028956027448025938013f27012a1a00180f000c0700050300020100010000010000010000010000030200080500"
+          "100a001e1300321f00492d01633e017e4e02925b02a16502a96a02a26502965e028251026942014e3101362100221500120b000905000402000201000100000100000100000201000402000b0700150d002617003a24015435016e4501865402"
+          "9a6002a46602a869029e63028e5902794c025e3a01442b012e1c001b11000e09000604000201000100000100000100000100000201000604000e09001b11002e1c00442b015e3a01794c028e59029e6302a86902a466029a60028654026e4501"
+          "5435013a2401261700150d000b0700040200020100010000010000010000020100040200090500120b002215003621004e3101694201825102965e02a26502a96a02a16502925b02",
+          "613d01472c01301e001d12000f09000704000302000100000100000100000100000201000603000d08001a10002c1b004229015c39017649028c57029e6302a66802a567029d62028855027046015736013d2601281900170e000c0700040200"
+          "020100010000010000010000010000040200080500110a002014003420004c2f01663f01805002945d02a16502ab6b03a16502945d02805002663f014c2f01342000201400110a00080500040200010000010000010000010000020100040200"
+          "0c0700170e002819003d26015736017046018855029d6202a56702a668029e63028c57027649025c39014229012c1b001a10000d08000603000201000100000100000100000100000302000704000f09001d1200301e00472c01613d017c4e02"
+          "8f5902a06402a86902a46602985f028452026b4301523301382300241600140c000a06000402000201000100000100000100000201000402000a0600140c002416003823005233016b4301845202985f02a46602a86902a064028f59027c4e02"
+          "613d01472c01301e001d12000f09000704000302000100000100000100000100000201000603000d08001a10002c1b004229015c39017649028c57029e6302a66802a567029d62028855027046015736013d2601281900170e000c0700040200"
+          "020100010000010000010000010000040200080500110a002014003420004c2f01663f01805002945d02a16502ab6b03a16502945d02805002663f014c2f01342000201400110a00080500040200010000010000010000010000020100040200"
+          "0c0700170e002819003d26015736017046018855029d6202a56702a668029e63028c57027649025c39014229012c1b001a10000d08000603000201000100000100000100000100000302000704000f09001d1200301e00472c01613d017c4e02"
+          "8f5902a06402a86902a46602985f028452026b4301523301382300241600140c000a06000402000201000100000100000100000201000402000a0600140c002416003823005233016b4301845202985f02a46602a86902a064028f59027c4e02"
+          "613d01472c01301e001d12000f09000704000302000100000100000100000100000201000603000d08001a10002c1b004229015c39017649028c57029e6302a66802a567029d62028855027046015736013d2601281900170e000c0700040200"
+          "020100010000010000010000010000040200080500110a002014003420004c2f01663f01805002945d02a16502ab6b03a16502945d02805002663f014c2f01342000201400110a00080500040200010000010000010000010000020100040200"
+          "0c0700170e002819003d26015736017046018855029d6202a56702a668029e63028c57027649025c39014229012c1b001a10000d08000603000201000100000100000100000100000302000704000f09001d1200301e00472c01613d017c4e02"
+          "8f5902a06402a86902a46602985f028452026b4301523301382300241600140c000a06000402000201000100000100000100000201000402000a0600140c002416003823005233016b4301845202985f02a46602a86902a064028f59027c4e02"
+          "613d01472c01301e001d12000f09000704000302000100000100000100000100000201000603000d08001a10002c1b004229015c39017649028c57029e6302a66802a567029d62028855027046015736013d2601281900170e000c0700040200"
+          "020100010000010000010000010000040200080500110a002014003420004c2f01663f01805002945d02a16502ab6b03a16502945d02805002663f014c2f01342000201400110a00080500040200010000010000010000010000020100040200"
+          "0c0700170e002819003d26015736017046018855029d6202a56702a668029e63028c57027649025c39014229012c1b001a10000d08000603000201000100000100000100000100000302000704000f09001d1200301e00472c01613d017c4e02"
+          "8f5902a06402a86902a46602985f028452026b4301523301382300241600140c000a06000402000201000100000100000100000201000402000a0600140c002416003823005233016b4301845202985f02a46602a86902a064028f59027c4e02"
+          "613d01472c01301e001d12000f09000704000302000100000100000100000100000201000603000d08001a10002c1b004229015c39017649028c57029e6302a66802a567029d62028855027046015736013d2601281900170e000c0700040200"
+          "020100010000010000010000010000040200080500110a002014003420004c2f01663f01805002945d02a16502ab6b03a16502945d02805002663f014c2f01342000201400110a00080500040200010000010000010000010000020100040200"
+          "0c0700170e002819003d26015736017046018855029d6202a56702a668029e63028c57027649025c39014229012c1b001a10000d0800060300020100010000010000010000010000" } },
+    { "fire", 600, 0x71d3294d, {
+          "0000000000000000000000000000000000004c0000ff2c00ff2c00180000840000fffffcb400000000000000000000000000000000000000000000000000000c00003c0000840000a000006800001c00000000000000000c00003c0000a40000"
+          "ff0800ff1c00d800009c00006c00004000003c00005800008c0000a40000a80000b40000cc0000e00000d400009c0000500000180000000000000000000000000000000000080000080000040000000000000000000000000000000000000000"
+          "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+          "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+          "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+          "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+          "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+          "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+          "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+          "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+          "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+          "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+          "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+          "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+          "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+          "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+          "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+          "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+          "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+          "ffff08ffd400fff400ffe000fff000ffe400fffffcffe400ffec00ffff00ffff34ffff44ffff20ffff0cffff70ffff94ff9400ff00008000002400000800002c0000880000d40000a80000380000000000000000000000000000000000000000"
+          "0400001400002400002400000c00000000000000000000000000000000000000000800002400005400007c00008000005c00002800000800000000000000000000000000000400001800003000005400006c0000780000780000700000600000"
+          "5400003c00002c00001800000800000000000400000c00001000001000000800000000000000000000000000000000000400001400002800003800003c00003000002000000c00000c00001400001c0000240000240000300000380000340000"
+          "280000180000040000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+          "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+          "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+          "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+          "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+          "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+          "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+          "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+          "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+          "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+          "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+          "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+          "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+          "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+          "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+          "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+          "ffa400ff7c00ff9400ff8400ff9000ff8400ff8c00ff8400ff8c00ff9400ffc000fffc00ffff00ffb800ffac00ffff28ffff24ff7c00ff7800ff7800ff7c00ff7c00ff7c00ff7c00ff7c00ff7800ff7c00ff7c00ff7c00ff7800ff7c00ff8000"
+          "ff7c00ff7400ff7000ff7000ff7c00ff9800ffc400ffe400ffe800ffd800ffd000ffd800ffd800ffcc00ffb800ffb400ffc000ffd800ffec00fff000ffec00ffd000ffc000ffb000ffac00ffb400ffb400ffc400ffd000ffd800ffd400ffb800"
+          "ff8800ff5000ff1000c400007800003400000c0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+          "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+          "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+          "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+          "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+          "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+          "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+          "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+          "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+          "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+          "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+          "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+          "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+          "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+          "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+          "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+          "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000",
+          "ffffd0ff3400ffff44fffffcffff0cffb800fff000ffcc00ffdc00ffcc00ffd800ffdc00ffff08ffff38ffff38fff800ffd000fff400ffff4cffff28ff8000ff8c00ffc400fffc00fffc00ffc800ffa000ff7c00ff4800ff2c00ff2800ff3000"
+          "ff3800ff4c00ff7c00ffb400ffe000fffc00ffff08fffc00ffc400ff7400ff3800ff2000ff2000ff3400ff5400ff7c00ff9800ffa400ff9c00ff9000ff8000ff7c00ff8c00ff9c00ffa800ffa800ffa000ff9400ff8400ff7400ff7000ff6c00"
+          "ff6c00ff6800ff6c00ff7000ff6c00ff6400ff4c00ff3400ff1c00ff1400ff1000ff1000ff0c00ff0c00ff0800ff0400ff0400ff0400ff0400ff0800ff0c00ff1000ff1c00ff2800ff4000ff5400ff5c00ff5c00ff5c00ff5c00ff5800ff5400"
+          "ff5000ff5c00ff6400ff6400ff6400ff6400ff6000ff5c00ff5800ff4c00ff4400ff4000ff4000ff4000ff4000ff3400ff2400ff0c00e80000bc00008c00005400002800000c0000000000000000000000000000000000000000000000000000"
+          "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+          "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+          "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+          "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+          "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+          "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+          "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+          "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+          "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+          "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+          "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+          "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+          "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+          "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+          "000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000" } },
+    { "twinkle", 600, 0x86cd1e8b, {
+          "9d6202a46602905a027046018a5602ab6b036640018453028a56029d62027046015636015e3b01ab6b03704601ab6b038a5602744902965e028a56029d6202744902ab6b036b43019d62024c2f01a466025e3b017a4c028453025e3b01704601"
+          "905a02a46602744902a46602905a029d6202905a023f27017046015a38019d6202905a028453026640017449028a5602ab6b039d6202905a02ab6b03a46602664001965e02845302221500905a026b4301905a028a5602623d01a466029d6202"
+          "905a02965e02ab6b03965e025e3b019d62024229017f4f02482d01845302a46602ab6b03422901ab6b030e09007046013a2401563601704601a46602482d01a466026640017f4f02905a02ab6b03ab6b039d62027a4c029d6202ab6b037f4f02"
+          "ab6b03a466025e3b01905a027f4f028a56029d6202ab6b03ab6b03ab6b037f4f02ab6b03905a027a4c02563601905a027449027046018a5602ab6b03321f009d62024c2f018a5602965e025a38016640013f27019d6202a46602845302744902"
+          "744902a46602704601ab6b03ab6b03965e027449028453027449025e3b01905a025a3801523301623d01965e02a46602ab6b035233018a56023c26018a5602ab6b03744902ab6b037f4f026b43018a5602623d017046019d62027a4c02845302"
+          "7f4f029d6202ab6b038453028a56028a5602a46602623d01965e029d6202ab6b03965e02965e02965e02ab6b038453029d62024f31015636018a56023722008a5602ab6b037a4c029d62028a56028a5602523301261700a46602a466027f4f02"
+          "9d62027046019d6202523301965e023c2601905a02ab6b039d6202301e00845302452b01905a022a1a00ab6b03ab6b038a5602482d019d6202523301a46602905a02ab6b03ab6b03905a028453024f31012819005e3b018a56028a56027f4f02"
+          "130c007a4c027046018a5602704601ab6b036b43019d62024f3101905a02ab6b03ab6b039d6202a46602704601a46602905a02905a02ab6b03905a02a466024f31017a4c026b4301965e02623d01ab6b03965e02664001704601a46602a46602"
+          "ab6b03ab6b03ab6b034c2f016b43018a56028a5602845302623d018a5602704601ab6b036b43016b4301704601744902905a02623d01482d01965e028a56026b43015636017a4c02664001845302664001845302a466029d6202452b01ab6b03"
+          "744902ab6b038a5602744902965e028a5602201400965e02422901965e024c2f019d6202ab6b038453029d6202ab6b03905a028a5602ab6b035a38019d62029d6202623d01a46602ab6b037a4c027a4c02a466026b4301905a02623d01ab6b03"
+          "8a5602482d018a56029d62024c2f01ab6b03a466026b4301ab6b03a46602905a027449025233014f3101905a02ab6b037f4f02ab6b037449024f31018453028a5602ab6b03563601905a024c2f01ab6b03905a02905a026640019d6202a46602"
+          "7046017046016b4301905a02a466029d6202a46602321f007f4f02ab6b03563601ab6b034f3101965e027449028453025636017f4f02452b015636016b43017449029d62029d6202965e024c2f01664001a46602623d01905a024c2f017f4f02"
+          "ab6b03a466029d6202ab6b035e3b01a46602221500845302a466027046017449029d62027046019d62027a4c02a46602623d01452b01845302ab6b03965e02965e02a46602905a02ab6b034229013c26018a56029d6202905a02965e02ab6b03"
+          "8a56028a5602ab6b033c2601ab6b03965e024f31014c2f01664001905a027449027f4f023f27015e3b01704601965e02965e02744902704601ab6b03965e027a4c02a46602965e028a5602ab6b03ab6b035a3801a46602ab6b034c2f01482d01"
+          "ab6b03965e027046015636015233017f4f028a5602a466027a4c029d62028a56027f4f02965e02ab6b038a56026b4301704601a466022e1c007449024c2f013f27017046017a4c02ab6b039d62027449028a5602845302ab6b035636018a5602"
+          "704601452b01905a02301e00905a02905a029d62029d62026b4301965e028453028a5602623d01a466029d62028a5602965e02ab6b03905a026b4301744902a466027f4f028a5602905a027f4f02965e028453024c2f018a5602422901563601"
+          "a46602ab6b033f2701965e027a4c021b1100905a028453029d62027f4f02a466026640019d62027449029d62027a4c029d62029d6202ab6b036640012e1c00905a026b4301a46602905a02ab6b032215004f3101ab6b03a466029d62026b4301"
+          "a466026b4301a466027046017f4f02ab6b03ab6b03905a02ab6b03664001965e02ab6b037a4c024f31013a24019d62028a56027046019d62028a56025636016640015233017a4c02ab6b03a46602a46602ab6b03563601ab6b038a5602965e02"
+          "7449029d6202965e028a56025e3b019d6202ab6b034229011c1100664001965e029d6202845302744902704601482d01905a029d62024c2f01704601a46602ab6b036b4301422901",
+          "4f31018a5602a46602623d018a5602a466029d62028a5602ab6b03a46602905a02965e02241600ab6b039d6202422901905a029d62027f4f02623d019d6202965e02965e027f4f027f4f029d62027046018a56028453028453028453028a5602"
+          "8a5602905a02a46602ab6b03ab6b03ab6b03965e028453023421002c1b00563601623d015e3b018a5602a46602905a02704601905a027f4f02a46602a466028a5602664001965e02664001845302965e02a466025a38017f4f02965e02a46602"
+          "a46602ab6b03905a02a46602744902965e02a46602ab6b031f1300965e02ab6b03905a029d62026b4301a466029d62028453027a4c024c2f017f4f02ab6b035a3801ab6b03965e026640015a38018a5602704601664001ab6b033722007a4c02"
+          "342100a46602704601965e02905a02ab6b03965e02623d01845302a466027046019d62026640014c2f01482d01ab6b039d6202623d016640016b4301ab6b035636019d62026b4301ab6b035e3b016b4301905a02965e027a4c028a56027f4f02"
+          "965e027f4f029d6202a46602563601ab6b03905a027046018a56027f4f02704601905a02965e026b4301ab6b035a38016b43018a56029d6202a46602ab6b03a46602ab6b03905a02965e02965e027a4c02ab6b037a4c02623d017449029d6202"
+          "2014006b43019d6202ab6b037a4c02965e028a56027449027a4c02523301965e02ab6b033722009d62025e3b01965e02965e027a4c026640016640017449029d62029d62023f27018a56029d6202965e027a4c02905a02744902965e02ab6b03"
+          "905a026b43013c2601ab6b03ab6b035a3801623d01965e02ab6b03ab6b033f2701744902a46602ab6b03ab6b03965e02905a029d62029d6202905a029d6202a46602965e027a4c02744902965e02523301ab6b036640019d62025e3b01452b01"
+          "7f4f02ab6b038453027a4c021b11007449025636017a4c028453027046017046015233017046017a4c028453028a5602664001664001a466029d6202965e02482d016640019d6202965e02965e02a466027449029d6202ab6b035e3b01845302"
+          "8453028a56023f27019d62022a1a009d6202845302ab6b038a5602905a02965e029d62029d6202482d013722006b4301ab6b03ab6b038a56024f3101965e025e3b017449026b4301a46602ab6b039d6202965e02664001905a028a5602744902"
+          "845302a466028a5602ab6b039d6202965e02845302ab6b034c2f017449027a4c025e3b017f4f025a3801965e02ab6b036b4301a466026b43019d62023a24015233017a4c029d6202965e029d6202623d01a466028453029d6202965e02905a02"
+          "8453029d62028453028453024f31019d62028a56028453029d62026b43019d62028453022a1a00ab6b038453027046017f4f02a466023f2701a46602744902965e026640015a38019d62028453026b4301563601704601965e024f3101905a02"
+          "905a028a5602482d017a4c02744902905a027a4c02965e02ab6b035e3b01704601ab6b039d62026b4301744902704601664001905a024f3101ab6b03ab6b039d6202372200301e00744902ab6b035a3801845302965e024f31014f31018a5602"
+          "905a029d62026b43017f4f02ab6b03a46602a46602704601623d01965e029d62028453027a4c027f4f027a4c023f27019d6202845302422901905a028a56029d62027a4c025e3b01965e026b43012416005a38018a5602965e02623d017f4f02"
+          "5a3801845302905a02ab6b03623d01ab6b03a466027a4c029d62026640018a56024f3101845302100a00ab6b03ab6b037f4f02482d015e3b01a46602965e02a466021a10005a3801ab6b039d6202ab6b03965e02a466022c1b009d6202664001"
+          "8a5602965e028a56028a56027a4c027a4c02ab6b03905a02563601704601744902452b01ab6b037f4f024229014f31019d62029d6202905a02965e02905a027a4c02905a02a46602704601a46602a466025233017449027f4f02ab6b03905a02"
+          "ab6b03ab6b03a466029d62027f4f02965e028a5602ab6b039d6202ab6b03744902623d01ab6b03342100623d019d6202965e028a5602ab6b03905a025a3801905a02845302744902623d01905a023c2601523301140c008a5602a46602623d01"
+          "8a5602845302704601ab6b036640015e3b017f4f027a4c028453026b4301a46602a46602ab6b035a3801905a029d6202ab6b03a46602965e024f3101623d018a5602744902845302905a029d6202623d016b43019d62029d62025a38017a4c02"
+          "261700a46602905a02ab6b039d62025e3b01965e027f4f02845302a466023f2701845302ab6b037a4c023a24017f4f02965e02965e02905a02ab6b039d62027a4c02905a02a466029d62029d6202120b00a466022e1c00452b017a4c029d6202"
+          "523301965e02a466026b4301301e00905a02ab6b035e3b019d6202a46602905a029d62027f4f024c2f01965e025a38016b4301845302965e02965e02ab6b037f4f024c2f01a46602",
+          "965e026b43011c11004c2f019d6202281900ab6b03a46602905a02ab6b037449029d62028a5602845302ab6b035a3801482d01ab6b035e3b017a4c02905a025e3b018a5602ab6b03a466029d6202a466028a56028453026b43016640019d6202"
+          "8453027046015e3b01ab6b034c2f01965e029d6202ab6b03744902ab6b03623d019d6202301e00a466027f4f02ab6b03a466027f4f02845302623d01965e02845302845302a46602ab6b035233019d62024229017a4c02965e028a5602905a02"
+          "a466026640018a56027f4f02905a025e3b017449027f4f025e3b017046017a4c02905a02ab6b03ab6b037f4f029d62026b4301452b01a466028a5602ab6b037a4c02ab6b03a46602704601422901623d01a46602965e028a56029d6202664001"
+          "7a4c028a56028453028a5602845302905a02342100744902ab6b03905a026b43018a56029d6202704601ab6b03ab6b034c2f017449028453025a3801965e02a46602ab6b038a5602100a00ab6b037f4f02a466028a56024c2f01ab6b032e1c00"
+          "905a02a466029d62028453028a5602ab6b03452b017f4f02ab6b037f4f02704601845302965e028453023f27017046018a5602a46602a46602342100965e02965e02965e02965e028a56029d62025e3b01744902704601482d016b4301422901"
+          "623d012e1c007a4c02a466024c2f01744902965e02905a028a5602965e027f4f02965e02a466029d62025a38017449029d6202ab6b037a4c02905a02ab6b033f27018a5602a46602ab6b03845302a46602ab6b037f4f02744902ab6b03523301"
+          "8a5602ab6b03a466028a5602ab6b03ab6b039d6202ab6b037f4f027f4f026b43017a4c023a2401623d01ab6b03ab6b03ab6b039d62029d62028453028a5602ab6b03a46602ab6b03a46602ab6b03905a02ab6b037046017046013f27014f3101"
+          "7f4f026b43019d6202a46602965e027a4c02905a024f31016b43018453027f4f02965e024f3101ab6b038453027a4c02744902704601965e029d6202ab6b034c2f017f4f02965e027a4c02452b01905a026b4301a46602623d019d62029d6202"
+          "ab6b039d62027449029d6202ab6b03a46602523301704601a46602664001ab6b03a46602a46602905a02482d018453027a4c029d6202965e028a5602965e027f4f02a466027f4f026b43019d6202845302241600563601905a02744902965e02"
+          "9d62027f4f028a56029d6202452b019d62024c2f01523301ab6b03704601ab6b03523301ab6b03a46602905a02a466027a4c027449026b43018a56028a56029d6202ab6b03704601623d019d62028a5602744902a46602a466027f4f02a46602"
+          "9d62029d62029d6202321f00160d006640019d6202965e028a5602ab6b03623d017f4f02a466028453025a38016b43017a4c028a56029d6202ab6b03ab6b037a4c026b4301845302ab6b03905a027f4f02a46602965e025a38018453028a5602"
+          "5a38017f4f02905a028a56029d62025636015636018a56027f4f02704601744902563601744902965e02845302965e02845302a466028453027046019d62027a4c02452b01a46602ab6b039d62026b43015a38019d6202a46602a46602845302"
+          "5e3b01a466027046019d62023f27019d62026640019d6202a466026b4301a466022e1c00ab6b03704601965e02965e02a46602965e02452b01a466027f4f027f4f029d6202482d01ab6b039d62027046017f4f025636018a56029d62024c2f01"
+          "905a02965e027f4f02965e029d6202ab6b032a1a006b43018a56026b4301563601482d01a466027449027f4f028453028453025e3b01965e02623d019d62027a4c02623d01744902905a02ab6b037a4c02a46602965e02ab6b03704601664001"
+          "7f4f02965e027449026640014229015a38017f4f027a4c029d62022c1b008a5602ab6b039d62027449026640014229019d6202ab6b03ab6b03ab6b037f4f02ab6b035a3801a466024f31016b4301744902a46602ab6b037a4c029d6202965e02"
+          "7f4f022e1c006b4301965e02744902965e028a5602664001452b01452b017046015a3801965e029d62028453021e12007a4c02965e02744902704601965e02a466028a5602523301905a02ab6b037a4c02965e02965e029d6202905a027a4c02"
+          "8a5602ab6b038453026640019d6202ab6b03905a02ab6b03ab6b03ab6b037f4f026b43018a56029d62028a5602ab6b03a46602452b01482d01623d01905a02965e024c2f01ab6b038a56029d6202905a029d62025e3b019d62026640018a5602"
+          "9d6202845302905a02704601905a027046015e3b016b43018453025636016b4301ab6b039d6202a466028a5602905a027449025a3801ab6b039d6202261700a46602452b015e3b015e3b01a46602452b01ab6b03ab6b03965e027a4c028a5602"
+          "8a5602905a02905a023722007f4f028a56027f4f022c1b00905a02965e028a5602965e02321f007f4f025636017f4f024c2f01ab6b03a466024f3101ab6b036b43018a5602422901",
+          "8a56029d6202965e02623d01ab6b034f31019d6202ab6b03482d016b43018a56023421004c2f01523301905a028453027046019d62026b43019d6202a46602623d015a38019d6202965e02845302744902905a02965e027f4f023f2701965e02"
+          "9d62028a5602905a025e3b013a24019d6202905a02845302965e025e3b01261700905a02744902ab6b038a56028a5602a46602905a027f4f029d62028a5602845302523301965e02563601452b019d6202905a029d6202845302845302905a02"
+          "965e029d6202845302ab6b03965e025a3801ab6b037a4c029d6202965e027a4c02452b01a46602664001ab6b038a5602965e026b4301ab6b03ab6b03664001905a02ab6b03ab6b035636018a56029d6202563601965e024f31018a5602523301"
+          "623d01845302a46602905a02a46602905a02ab6b038a5602905a02664001ab6b036b4301ab6b03ab6b037a4c026640013421008a5602965e02905a02ab6b035e3b01744902905a029d62029d6202965e026640019d62029d6202623d01905a02"
+          "452b01563601ab6b03623d017046018a5602301e00845302301e00a46602ab6b038a56025636017a4c02a466025636017046019d62027449029d6202905a026b4301965e027f4f029d6202623d01845302905a027f4f025e3b01905a024f3101"
+          "a46602ab6b03452b01a46602965e02523301704601a46602a46602ab6b038453029d62027f4f02965e029d6202a466027449028a5602905a027f4f029d6202744902a466029d62027f4f025a38014f31019d6202a466029d62023f27015e3b01"
+          "905a028453028a56028453027046019d6202965e02ab6b03ab6b037046015a3801664001a466025e3b017046018a56027f4f02a466029d6202a46602623d01905a028a5602623d01523301965e027449027f4f029d62027449026b43017f4f02"
+          "9d6202a466025636019d62027a4c027f4f022014007a4c02965e027f4f027046015e3b01ab6b037f4f02ab6b039d6202744902965e029d6202704601ab6b03a466022c1b00965e02a466029d62027a4c024229016b4301965e02623d01ab6b03"
+          "a46602965e02ab6b038453025e3b019d62027046019d62025e3b01a46602623d01664001905a02905a029d62027046019d62029d6202452b01ab6b03ab6b03a466026b4301965e02965e02ab6b03965e029d62026b4301965e02905a025a3801"
+          "7046019d6202965e028a5602845302ab6b03482d01965e02120b00965e02a46602a466029d62025e3b018a5602905a02a466029d62025e3b01ab6b032014008a56029d62027a4c029d62028a56028a56029d6202965e02ab6b038a5602a46602"
+          "a46602623d01a46602a46602845302ab6b03965e02845302a46602a46602905a027a4c02a466027a4c02a466029d6202905a02ab6b037f4f02905a02ab6b03905a02a46602ab6b03a46602ab6b03ab6b035a3801744902965e025e3b01965e02"
+          "7a4c028a56027a4c029d6202905a027a4c02a46602a466029d6202ab6b038a56029d6202a46602845302905a029d6202965e029d62027046019d6202ab6b039d6202965e029d6202ab6b038a5602905a02965e027f4f02965e029d62029d6202"
+          "7a4c029d6202a46602482d01623d01965e02a46602523301ab6b03563601905a029d6202180f009d62025233016b4301563601905a02905a02623d01905a029d62027449024229016b43016b4301ab6b03301e00ab6b033a2401905a027f4f02"
+          "7a4c027a4c027a4c029d6202905a02a46602845302905a02a466027a4c027f4f026b4301a46602905a029d6202a46602845302905a02ab6b03ab6b03a46602965e02965e027f4f024229018453028a56029d62027f4f027a4c028a5602905a02"
+          "ab6b03ab6b03ab6b036640019d6202845302965e025a3801523301744902a46602a46602a46602704601a466028a5602744902965e02ab6b035233017f4f02a466027f4f027f4f02905a02664001261700664001ab6b038a56028a5602ab6b03"
+          "905a028453024229018a5602452b015e3b018a56025a38015a38017a4c02704601965e028a5602ab6b037046017f4f02744902905a02a46602ab6b03ab6b03422901905a02a466023f2701a46602a466026b43016b4301965e02201400a46602"
+          "ab6b036b43019d6202ab6b03a46602301e00301e009d62028453027449027a4c027046018453029d62028a5602452b018a5602905a02623d015233018453024f31019d62022617009d62025233018a56025a3801965e027f4f02965e023a2401"
+          "965e027a4c02845302ab6b03965e02905a027449028453027f4f02a46602905a02ab6b037449028a5602664001ab6b03845302a46602905a02a466025233019d62026b43016b4301ab6b039d6202905a02ab6b03ab6b03664001704601704601"
+          "6b43017f4f02905a02ab6b038453027046018453023f27015636019d6202ab6b037a4c02a466027f4f029d62028a5602342100965e02905a022a1a008453029d6202281900ab6b03" } },
+    { "field", 600, 0x91c311b1, {
+          "977904957804957904947804947804917904917b05907a058f7b058e7a048e7d048d7b048b7d048a7b048a7d04897e05877c05877f05867d05847d05847f05817f06817e057f7e057a7f05757f05757f066f7e066b7f06677f06618006617f06"
+          "5c7e06548106537f074f80074b7f06478106437f074080073b8007388007347f07337e07307e082d7c072a7d08267c08237b08207a081d7b081a7908187a081579081279080f77080d78080b7608087508087408087009086e0a096a0c08680c"
+          "08650d09640f08600f085f0f095c11085b11095912095612095514095214095113094f15094d15094c15094b16094816094716094717084616084417094317094318094117094018083f18083f18083e18083d18083d18093c18093c18093c18"
+          "093c18083b18083b18083b18083b18083b18083b18083b18093c18093c18093c18093c18083d18083d18083e18083f18083f18094018094117094318094317084417084616094717094716094816094b16094c15094d15094f15095113095214"
+          "095514095612095912085a11095c11085f0f08600f09640f08650d08680c096a0c086e0a0870090874080875080b76080d78080f77081279081579081778081a79081d7b08207a08237b08267c082a7d082d7c07307e08308008347f07388007"
+          "3b8007408007437f074780064b7f064c80075081075481065c7e06617f06618006677f066a7f066f7e06707f06757f05797d057f7e05818005817f06837e05847f05857e05867d05877f05877c05897c048a7d048a7b048b7d048d7b048e7d04"
+          "8e7a048f7b05907a05917b05917904937a049478049478049579049578049779049779049877049978049978049975049975049a76049b75039b75039d76039d76039d74039d74039e75039e75039e75039f73039f73039f73039f7303a17403"
+          "a17403a17403a17403a17103a17103a17103a17103a17103a17103a27203a27203a27203a27203a27203a27203a27203a27203a27203a27203a27203a27203a27203a27203a27203a27203a27203a27203a27203a27203a27203a27203a27203"
+          "a27203a17103a17103a17103a17103a27203a17103a17103a17103a17103a17103a17103a17103a17103a17403a17403a17403a17403a17403a17403a17403a17403a17403a17403a17403a17403a17403a17403a17403a174039f73039f7303"
+          "9f73039f73039f73039f73039f73039f73039f73039f73039f73039f73039f73039f73039f73039f73039f73039f73039f73039f73039f73039f73039f73039f73039f73039f73039f73039f73039f7303a17403a17403a17403a17403a17403"
+          "a17403a17403a17403a17403a17403a17403a17403a17403a17403a17403a17403a17403a17403a17103a17103a17103a17103a17103a17103a17103a17103a17103a17103a17103a17103a27203a27203a27203a17103a17103a27203a27203"
+          "a27203a27203a17103a27203a27203a27203a17103a17103a27203a27203a17103a17103a17103a17103a17103a17103a17103a17103a17403a17403a17403a174039f73039f73039f73039f73039e75039e75039e75039d74039d76039d7603"
+          "9d76039b75039b75039a7604997504997504997804997804987704977904977904957804957904947804937a04937a04917b05917b05907a058f7b058e7a048e7d048b7d048b7d048a7d04897c04897e05877c05867d05857e05847d05837e05"
+          "817f06817e057f7e05797d05757f05707f066b7f066a7f06657e06617f065c7f06588006537f074f80074b7f06478106437f073f7f073b7e07377f07347f073080082d7c072a7d08267c08237b08207a081d7b081a79081778081279080f7708"
+          "0d78080b7408087408087009086e0a096a0c08680c08650d08600f085e10085b11095912095612085313095113094d15094b16094816094716084616094317094117083f18083d18083b18083a1908381908371908361908351a09331a08321a"
+          "08311a08301a082e1a082d1a082d1b082c1a082b1b082a1a08291b08281b08281b08261c08261b08251c08251c08251c08251c08241c08241c08241c08241c08241c08241c08241c08251c08251c08251c08251c08261b08261c08281b08281b"
+          "08291b082a1a082b1b082c1a082d1b082d1a082e1a08301a08311a08321a09331a08351a083619083719083819083a19083b18083d18083f18094117094317084616094716094816094b16094f15095113085313095612095912085b11085e10"
+          "09620e08650d08680c096a0c086e0a0870090874080b76080d78081277081478081778081a79081d7b08207a08237b08267c082a7e072d7e07308008347f07377f073b8007408007437f074781064b7f065081075481065880065c7f06618006"
+          "677f066a7f066f7e06757f06757f057a7f05818005817e05837e05847f05857e05867d05877f05897e05897c048a7d048a7b048d7b048e7d048e7a048f7b05907a05917904917904",
+          "907a058f7b058f7b058e7d048d7b048b7d048a7d04897c04897e05877f05867d05857e05847f05837e05817e057f7e057a7f05757f05757f066b7f066a7f06657e06617f065c7e065880065081074f80074781064780064080073b8007388007"
+          "347f073080082d7c072a7d08267c08237b08207a081a7a08187a081478081277080f76080b7608087508097209086e0a096a0c08660d09620e085f0f085b11095912095612095214095015094d15084a16094716084417094318094018083d18"
+          "083b18093a1908371908361909331a08321a08301a082e1a082d1b082c1a08291b08281b08261b08251c08231c08211d08201d081f1c081e1d071c1e071b1f081b1e07191e07181f07181f07181e07161e07161e07151e07151e07151e07151e"
+          "07151e07141e07141e07141e07141e07141e07141e07141e07151e07151e07151e07151e07151e07161e07161e07181e07181f07181f07191e081b1e071b1f071c1e081e1d081f1c08201d08211d08231c08251c08261b08261c08291b082b1b"
+          "082d1b082d1a08301a08311a09331a08351a083719083819083a19083d18083f18094318094317094717094816094c15094f15095113095514095713085a11095c1108600f09640f08680c086c0b086e0a0972090875080b76080d7808127708"
+          "1478081778081a79081d7b08207c08237b08267c082a7e072d7e07308008337e07377f073b7e073f7f07437f07437f074781064c80074f8007537f075481065880065c7f06617f06657e06677f066a7f066b7f066f7e06707f06757f06757f06"
+          "757f05797d057a7f057f7e058180057f7e05818005817e05818005817e05817f06817e05817f06817f06817f06817f06817f06817e05817f06817e05817e05817e05817e058180058180057f7e057f7e057a7f05797d05757f05757f05757f06"
+          "707f066f7e066b7f066a7f06677f06677f066180066180065c7f065c7e06588006537f07537f074f80074b7f064b7f06478006437f074080073f7f073b7e07388007347f07337e073080082d7c072a7e07267d08237d08237d08207c081d7b08"
+          "1d7b081a7908187a081579081279081277080f77080d78080d76080b7408087508097209087009086f0a086c0b09690c08680c08660d08650d09620e08600f08600f085f0f085e10095c11085b11085a11095912095713095612095514085313"
+          "085313095214095214095113095113095015095015095015095015094f15094f15094f15094f15094f15094f15094f15095015095015095015095015095113095113095214095214085313085313095514095612095713095912085a11085b11"
+          "095c11085e10085f0f08600f09620e09640f08650d08680c09690c096a0c086e0a086f0a0870090874080b74080b76080d76080f76081277081279081579081778081a79081d7b081d7b08207c08237b08267c082a7d082a7e072d7e07307e08"
+          "347f07377f073b7e073b8007408007437f074780064b7f064c8007508107537f075880065c7f06617f06618006677f066a7f066f7e06707f06757f05797d057a7f05818005817e05817f06837e05847f05857e05867d05877f05877c05897e05"
+          "897c048a7d048a7b048b7d048d7b048e7d048e7a048f7b05907a05917b05917b05917904937a04937a049478049579049579049578049578049779049877049877049877049978049978049978049975049975049975049a76049a76049a7604"
+          "9b75039a76049b75039b75039b75039b75039b75039b75039b75039b75039b75039b75039b75039b75039b75039b75039b75039b75039b75039a76049b75039a76049a76049a76049a7604997504997504997504997504997804997804997804"
+          "997804987704987704987704977904987704977904977904977904957804957804957804957904957904957904957904947804947804947804937a04937a04937a04917904917904917904917904917b05917b05917b05917b05917b05917b05"
+          "907a05907a05907a05907a05907a058f7b058f7b058f7b058f7b058f7b058f7b058e7a048e7a048e7a048e7a048e7a048e7a048e7a048e7a048e7a048e7a048e7a048e7a048e7a048e7a048e7a048e7a048e7a048e7a048e7a048f7b058f7b05"
+          "8f7b058f7b058f7b058f7b05907a05907a05907a05907a05907a05917b05917b05917b05917b05917904917904917904917904937a04937a04937a04947804947804947804947804957904957904957804957804957804977904977904977904"
+          "9877049877049877049978049978049978049975049975049a76049a76049a76049b75039b75039b75039d76039d76039d76039d74039d74039d74039e75039e75039e75039f73039f73039f7303a17403a17403a17403a17103a17103a17103"
+          "a27203a27203a27203a27203a37103a37103a37103a37103a57203a57203a57203a57203a46e02a46e02a46e02a46e02a46e02a56f02a56f02a56f02a56f02a56f02a66d02a66d02",
+          "a57203a57203a57203a37103a37103a37103a27203a27203a27203a17103a17103a17103a17403a17403a174039f73039f73039e75039e75039d74039d74039d74039d76039d76039b75039b75039a76049a7604997504997504997804997804"
+          "987704987704977904957804957804957904957904947804947804937a04937a04917904917b05917b05907a05907a058f7b058e7a048e7a048e7d048d7b048d7b048b7d048b7d048a7b048a7d048a7d04897c04897c04897e05897e05877c05"
+          "877f05877f05867d05867d05857e05857e05847d05847d05847f05847f05837e05837e05817f06817f06817f06817e05817e05817e058180058180058180057f7e057f7e057f7e057a7f057a7f057a7f057a7f057a7f05797d05797d05797d05"
+          "797d05797d05797d05797d05797d05797d05797d05797d05797d05797d05797d05797d057a7f057a7f057a7f057a7f057a7f057f7e057f7e057f7e05818005818005818005817e05817e05817e05817f06817f06817f06817f06817f06837e05"
+          "837e05847f05847f05847d05847d05857e05867d05867d05877f05877f05877c05877c05877c05897e05897e05897c04897c048a7d048a7b048a7b048a7b048a7b048b7d048d7b048d7b048e7d048e7d048e7d048e7a048e7a048e7a048f7b05"
+          "8f7b05907a05907a05907a05917b05907a05917b05917904917b05917904917b05917904917904917904917904917904917904917904917904917904917904917904917b05917b05917b05917b05907a05907a058f7b058f7b058e7a048e7a04"
+          "8e7d048e7d048d7b048d7b048b7d048a7b048a7d04897c04897e05877c05877c05867d05867d05847d05847f05837e05817f068180057f7e057a7f05757f05757f066f7e066b7f06677f06618006617f065c7e065481065081074c8007478106"
+          "4780064080073f7f07388007347f073080082d7c072a7e07267c08237b081d7b081a7a08187a081579081277080f76080b7608087408087009086c0b09690c08650d09620e085e10085b11095612085313095015094d15084a16094716084417"
+          "094117083f18093c18083a1908371908361909331a08311a082f1a082d1b082c1a08291b08261b08251c08221c081f1d081f1c071d1d081b1e07191e07181f07161e07161e07151e07131e07131e07111e07111f07101e060f1d060f1d070e1e"
+          "060d1e060d1d060c1d060c1c060c1c060c1d060c1d060b1c060b1c060b1d060b1d060b1d060b1d060b1d060b1d060b1d060b1c060b1c060c1d060c1d060c1c060c1c060c1d060d1d060d1e070e1e060f1d060f1d07101e07111f07111e07131e"
+          "07131e07151e07161e07161e07181f07191e081b1e071d1d081e1d081f1d08221c08241c08261b08291b082b1b082d1b082f1a08311a09331a08351a083719093a19093c18083e18094117094317094717084a16094c15094f15095214095514"
+          "085a11095c1108600f09640f08680c096a0c086e0a0972090b74080d76080f7608127908177808187a081a7a08207a08237b08267d082a7d082d7e07308008337e07377f073b7e073f7f07437f07437f074781064c80074f8007548106588006"
+          "5c7f06617f06618006657e066a7f066b7f066f7e066f7e06757f06757f05757f057a7f057f7e057f7e05818005818005818005817f06817f06817f06837e05837e05837e05837e05837e05837e05847f05847f05837e05837e05837e05837e05"
+          "837e05817f06817f06817f06817f06817e058180058180057f7e057a7f057a7f05797d05757f05757f06707f06707f066f7e066b7f066a7f06657e06657e066180065c7f065c7f06588006548106537f075081074f80074b7f06478106478006"
+          "437f074080073b80073b7e07388007377f07347f07308008307e082d7c072a7e072a7d08267c08267c08237b08207c081d7b081d7b081a7a081a79081778081579081478081277081277080f77080d78080d76080b76080b76080b7408087508"
+          "087408097209097209087009086f0a086e0a086e0a086c0b096a0c096a0c09690c09690c08680c08680c08680c08660d08660d08660d08660d08660d08660d08660d08660d08660d08660d08660d08680c08680c08680c09690c09690c096a0c"
+          "096a0c086c0b086e0a086e0a086f0a0870090972090972090874080875080b74080b76080d76080d78080f76080f7708127708127908157908177808187a081a7a081d7b081d7b08207a08237b08237d08267d082a7d082a7e072d7e07307e08"
+          "337e07347f07377f073b7e073b8007408007437f07437f074781064c80074f8007537f075481065880065c7f06617f06657e06677f066a7f066f7e06707f06757f06797d057a7f057f7e05817e05817f06837e05847d05857e05867d05877f05"
+          "877c05897e05897c048a7b048b7d048d7b048e7d048e7a048f7b05907a05917b05917904937a049478049478049579049578049779049779049877049978049975049a76049a7604",
+          "9d74039d74039d76039d76039b75039b75039a7604997504997504997804987704987704977904957804957904947804947804937a04917904917b05907a058f7b058e7a048e7d048e7d048b7d048b7d048a7d048a7d04897c04877c05877c05"
+          "867d05857e05847d05847f05837e05817f06817e058180057a7f05797d05757f05757f06707f066b7f066a7f06677f06657e06617f065c7f065c7e06588006548106537f074f80074c80074b7f06478106478006437f074080073f7f073b8007"
+          "3b7e07388007377f07347f073080083080082d7e072d7c072d7c072a7e072a7d08267d08267c08237d08237b08237b08207c08207a081d7b081d7b081d7b081a7a081a7a081a79081a7908187a08187a08187a08177808177808177808157908"
+          "157908157908157908157908157908157908157908157908157908157908177808177808177808187a08187a08187a081a79081a79081a7a081a7a081d7b081d7b081d7b08207a08207c08237b08237b08237d08267c08267c08267d082a7d08"
+          "2a7e072d7c072d7e07307e08308008337e07377f07377f073880073b80073f7f07408007437f07437f074780064781064c80074f8007508107537f075481065880065c7e06617f06618006657e06677f066a7f066f7e06707f06757f06757f05"
+          "797d057a7f057f7e05818005817e05817f06837e05847f05847d05857e05867d05877f05877c05897e05897c048a7d048a7d048a7b048b7d048d7b048d7b048e7d048e7a048e7a048f7b05907a05907a05917b05917b05917904917904917904"
+          "937a04937a04947804947804957904947804957904957904957904957904957804957904957804957804957804957804957804957804957804957804957904957904957904957904957904947804947804947804947804937a04937a04917904"
+          "917904917904917b05917b05907a05907a058f7b058f7b058e7a048e7a048e7d048d7b048d7b048b7d048a7b048a7b048a7d04897c04897e05897e05877c05877f05877f05867d05857e05847d05847f05847f05837e05817f06817f06817e05"
+          "8180057f7e057a7f057a7f05797d05757f05757f05757f06707f066f7e066f7e066b7f066a7f066a7f06677f06657e06618006618006617f06617f065c7f065c7f065c7e065c7e06588006588006548106548106537f07537f07537f07508107"
+          "5081075081074f80074f80074f80074f80074f80074c80074c80074c80074c80074c80074c80074c80074c80074c80074c80074c80074f80074f80074f80074f80074f8007508107508107508107537f07537f07537f07548106548106588006"
+          "5880065c7e065c7e065c7f065c7f065c7f06617f06617f06618006618006657e06677f066a7f066a7f066b7f066f7e06707f06707f06757f06757f05757f05797d05797d057a7f057f7e05818005817e05817e05817e05817f06837e05847f05"
+          "847d05857e05847d05857e05867d05877f05877f05877f05877c05897e05897e05897c048a7d04897c048a7d048a7b048a7b048a7b048a7b048b7d048b7d048b7d048b7d048d7b048b7d048d7b048d7b048b7d048d7b048d7b048b7d048b7d04"
+          "8d7b048b7d048b7d048a7b048a7b048a7b048a7d048a7d04897c04897c04897e05897e05877c05877f05867d05867d05847d05847d05847f05817f06817f068180057f7e057a7f05757f05757f06707f066f7e066a7f06657e066180065c7f06"
+          "5c7e065481065081074c8007478106437f074080073b8007388007347f073080082d7c072a7d08267c08207c081d7b081a7a081778081279080f76080d78080b7408097209086f0a096a0c08660d09620e085f0f085b11095713085313095113"
+          "094d15094816094717094317094018083d18083b1808381908361909331a08311a082f1a082d1b082a1a08261c08251c08221c081f1d081e1d071b1f07191e07181f07161e07141e07131e07111e07111f070f1e060e1d060d1e060c1d060c1c"
+          "060b1c060a1c060a1c06091b06081b06081b06071a05071a05071a05061b05061a05061a05061905051905051905051805051805051805051805051805051805051805051805051805051805051805051905051905061905061a05061a05061b"
+          "05071a05071a06071a06081b06081b06091b060a1c060a1c060b1c060c1c060c1d060d1e060e1d070f1e07111f07121e07131e07141e07161e07181f07191e071c1e081e1d081f1d08221c08251c08281b082b1b082d1b082f1a08311a083419"
+          "083719083819083b18083e18094117084417094717084a16094f15095214095514095912095c1108600f08650d08680c086c0b0870090875080d76080f76081277081579081a79081d7b08237b08237d082a7d082d7e07308008377f073b7e07"
+          "3f7f07437f074780064c80075081075481065c7e06617f06657e066a7f066f7e06757f06797d057a7f05818005817e05837e05847d05857e05877f05897e05897c048a7d048a7b04" } },
+    { "transitions", 600, 0x372ecceb, {
+          "1c12002f1d00452b005e3b00784a018b57019a6001a165019b60018f5901864d016f4a0b4a2e00331f00201400110a000804000301000100000000000200000600000800000801000b0600140c00241600372200503200694200805001935b01"
+          "9c6101a06401975e018755017348015937004129002c1a001910000d08000503000100000000000000000000000000000100000503000d08001910002c1a00412900593700734801875501975e01a064019c6101935b01805001694200503200"
+          "372200241600140c000a0600030100010000000000000000000000010000030100080400110a00201400331f004a2e00643f007c4d018f59019b6001a165019a60018b5701784a015e3b00452b002f1d001c12000f0900070400020100000000"
+          "0000000000000000000100000402000b0600160e002818003c25005535006f4401835201965d019d62019d6201965d018352016f44015535003c2500281800160e000b06000402000100000000000000000000000000000201000704000f0900"
+          "1c12002f1d00452b005e3b00784a018b57019a6001a165019b60018f59017c4d01643f004a2e00331f00201400110a000804000301000100000000000000000000000100000301000a0600140c00241600372200503200694200805001935b01"
+          "9c6101a06401975e018755017348015937004129002c1a001910000d08000503000100000000000000000000000000000100000503000d08001910002c1a00412900593700734801875501975e01a064019c6101935b01805001694200503200"
+          "372200241600140c000a0600030100010000000000000000000000010000030100080400110a00201400331f004a2e00643f007c4d018f59019b6001a165019a60018b5701784a015e3b00452b002f1d001c12000f0900070400020100000000"
+          "0000000000000000000100000402000b0600160e002818003c25005535006f4401835201965d019d62019d6201965d018352016f44015535003c2500281800160e000b06000402000100000000000000000000000000000201000704000f0900"
+          "1c12002f1d00452b005e3b00784a018b57019a6001a165019b60018f59017c4d01643f004a2e00331f00201400110a000804000301000100000000000000000000000100000301000a0600140c00241600372200503200694200805001935b01"
+          "9c6101a06401975e018755017348015937004129002c1a001910000d08000503000100000000000000000000000000000100000503000d08001910002c1a00412900593700734801875501975e01a064019c6101935b01805001694200503200"
+          "372200241600140c000a0600030100010000000000000000000000010000030100080400110a00201400331f004a2e00643f007c4d018f59019b6001a165019a60018b5701784a015e3b00452b002f1d001c12000f0900070400020100000000"
+          "0000000000000000000100000402000b0600160e002818003c25005535006f4401835201965d019d62019d6201965d018352016f44015535003c2500281800160e000b06000402000100000000000000000000000000000201000704000f0900"
+          "1c12002f1d00452b005e3b00784a018b57019a6001a165019b60018f59017c4d01643f004a2e00331f00201400110a000804000301000100000000000000000000000100000301000a0600140c00241600372200503200694200805001935b01"
+          "9c6101a06401975e018755017348015937004129002c1a001910000d08000503000100000000000000000000000000000100000503000d08001910002c1a00412900593700734801875501975e01a064019c6101935b01805001694200503200"
+          "372200241600140c000a0600030100010000000000000000000000010000030100080400110a00201400331f004a2e00643f007c4d018f59019b6001a165019a60018b5701784a015e3b00452b002f1d001c12000f0900070400020100000000"
+          "0000000000000000000100000402000b0600160e002818003c25005535006f4401835201965d019d62019d6201965d018352016f44015535003c2500281800160e000b06000402000100000000000000000000000000000201000704000f0900"
+          "1c12002f1d00452b005e3b00784a018b57019a6001a165019b60018f59017c4d01643f004a2e00331f00201400110a000804000301000100000000000000000000000100000301000a0600140c00241600372200503200694200805001935b01"
+          "9c6101a06401975e018755017348015937004129002c1a001910000d08000503000100000000000000000000000000000100000503000d08001910002c1a00412900593700734801875501975e01a064019c6101935b01805001694200503200"
+          "372200241600140c000a0600030100010000000000000000000000010000030100080400110a00201400331f004a2e00643f007c4d018f59019b6001a165019a60018b5701784a01",
+          "6941035635031e1303482c030c0803070403030203301e030000030000032f1d033a2403221500563500633e00301e00170e024f3103523303633e03392403704603794c037e4f036e4503764a04301e035a38031a10034127033923033f2703"
+          "2b1b03301d032d1c030000033823030000032e1d033622033f27030c08034d2f03583703613c036e44033d26037046037b4d03764a037b4d043622036841045d3a045032034b2f04442b04321f033622032c1b03382303311e032d1c03010003"
+          "3b2503321f03432903432903180f035d3a032d1d033823037a4b037c4d03462b034129033b25036740035f3b031c1203130c030b07033b24030201030100033521033a2403291a033823030100033f2704352003482d044b2f03593804643e04"
+          "6c4303684103724703462b037347037347033823032d1d03583703412903482c03382203050303301e03010003332003291a032b1b033e2604301e033b2503412903462c03160e035334035e3b036b43033e2703805004462c03432a037a4c04"
+          "6e4403633d03583703523204492e04321f032c1c030101033a24033a24033d2604332003301d033722033f27033d2603120a035233032517036d44047147037e4f047147038151044129036a4203301e035434035736044c2e03472c04342003"
+          "3c2503301d03000003311e030000033823033b25032e1d03070403442b03523204583703291903694103664003432a037e4f03432a03764a033622036841045837035334044b2f04070503342003010103321e030000032d1c030000033b2403"
+          "3e27043a24030905034a2d03180f03503203623e03633e036b42037e4e037b4c037b4d033b25036c43035c39035938044b2f030b07033b24033521033b24030000030000033a24030000032c1b030201033923033e27034229031c1203643e04"
+          "6740036e4503412903462b037146034027033823036a43045837035032034a2d033e2603382303321f033e26040000033d26043a2403301d030101033d26030705034b2f04160e034f31032b1b033622036942037d4e03835204432a033d2603"
+          "6c4303633d031e1303150c033522033420033b25033924033d26043521032b1b033d26043923033521033621030a06034127031a10034e3103301e03392403412903774b03774b03412903392403653f035a3803472c034328033f27033a2403"
+          "3521033e2604332003352103311e033521033b2503030203301e033924033e2603583703613c037146047a4c047d4e03462c037d4e03764a03362203603c035a3803160e03482d033f28033b25032c1c032e1c032b1b030000032b1b03321e03"
+          "0101033621033a2303100903180f03231603623e03754904734703774a03774903764a037549035f3b03503203513303503204482d043b24033a24033420033a24030000033823032d1c033b2403352103311e030b07033e27031c1203643e04"
+          "6a4203664003412903462b03794b037a4b037247036741035b3903180f034a2d033c25034229043e27040100033d2604000003000003362103392403362203442b044b2f04452b035535036841047348047b4d048050046f4603432a03754903"
+          "5f3b03663f04563603150c034129033621030302033b2503000003311e032b1b03332003301d033a2403321f030a0603120a034b2e03251703301e03764a04412903442b03442b036e4503764a045b3903583703492d03120a03352103362103"
+          "311e03301d033d2604311e033a2403000003392403321f030704033924034f30031e1303663f045f3b03724703432a037549037448037b4d04653f032b1b035d3a04432a03482d030705030302033622032e1c033320033a24030000033e2604"
+          "0101033823033822034a2d03180f035b39036741033823037347037c4d037b4c037e4f043b2503633d035c39035636033c26033823034329040201033b24032b1b033d26040000033a24033e26040201030603033e2703130c034f3203643e04"
+          "6c4303643f037e4f047749037e4e03754803633e032d1d03583703180f03100903432903050303362203301d03291a033a2403291a030100033e2704321f030705030e09034129032014036841047046037b4d04764a038352046e4503724703"
+          "633d035c3903472d03442903442b03321f03362203321f033a24032b1b033823033521032e1c03020103382303372203120a035434035a38036a42036c4403764a037549037e4f03794c03734803301e032517035233034c2e030a06033d2603"
+          "0201033b24033320032b1b03291a033a24033e27040302033c25033f28034a2d03513303633d033420033d2603784b03734803432a03764a033622035c3903201403432a03482d033823034028043e27043e26042b1b03000003332003010003"
+          "2c1c030503033621033f2603180f035434036540036b4303402703815004462b036a4303704603321f035836031c12034d3003482d04331f03311e03321e033a2403311e03291a03",
+          "ab6b03845302a466029d6202965e023c2601ab6b039d62029d62022617009d62028a56029d6202623d017f4f027a4c02744902965e026b43017f4f028a5602a46602965e029d6202845302905a026640017a4c02905a023421007449028a5602"
+          "905a02704601965e02905a026b4301623d01ab6b03452b01744902a46602965e02965e02905a02905a029d6202905a02a46602a466025a3801664001301e009d6202905a02905a02905a02845302a46602965e02744902905a028a5602905a02"
+          "a46602905a027a4c029d6202ab6b035e3b013421004229019d62025a3801a466028a56027f4f02a466027a4c02ab6b03965e027046016b4301a466029d6202a46602704601664001965e029d62027f4f02a46602a466029d6202ab6b037f4f02"
+          "ab6b033a24017a4c025a3801965e029d6202845302845302905a02965e02a46602a46602905a029d6202452b015e3b01965e02965e029d6202ab6b038a56027a4c023c2601704601664001845302965e029d62027f4f026b4301ab6b03ab6b03"
+          "5a3801ab6b03a466021e1200ab6b03a46602623d01ab6b038453026b43017449028453023a2401845302a46602452b01905a029d6202a46602452b01905a028a56027a4c02ab6b03965e02623d015a3801a46602744902845302905a025e3b01"
+          "ab6b03845302744902623d018a5602a46602a466028a56028453028453028453022a1a00ab6b039d6202845302ab6b03965e02ab6b035233016b4301a466027046014c2f015a3801664001a46602a46602905a02ab6b039d62029d62029d6202"
+          "905a02a466026b4301a466027f4f02ab6b03965e02ab6b034c2f019d62027a4c02965e02965e02482d01482d017449029d62025e3b019d6202482d01623d017f4f02704601a466027046018a56027046015e3b018453026640013a24018a5602"
+          "905a02ab6b039d62024c2f018453028a56028a56027046014f31018a56025e3b018453023421008453029d62028453028a5602a46602965e02261700ab6b039d62027f4f027f4f028a56029d62029d6202965e02ab6b036b4301965e029d6202"
+          "ab6b038453025e3b01ab6b03482d01965e028453023f27017a4c027f4f02a466029d62029d6202905a022215005a38017449025a3801482d01a46602a46602623d01a46602ab6b039d62024f31017f4f025233018453026640019d6202623d01"
+          "a46602905a026640018a5602a46602905a02ab6b035636016b4301965e02965e02a466023722004c2f016b43016640018453022416009d6202905a02845302623d01563601372200845302905a02ab6b03905a026b4301905a02ab6b038a5602"
+          "4229015a3801ab6b038a5602905a02664001ab6b037f4f026b4301261700ab6b037f4f02623d017f4f02ab6b035636013a24013a24015e3b014c2f01a46602ab6b03704601180f009d6202a46602ab6b03ab6b039d62028a5602744902a46602"
+          "9d6202905a02a466027f4f02a466028453027a4c026640017449029d6202704601563601a46602a46602a46602ab6b03a46602905a02a46602ab6b03744902ab6b03ab6b03905a02ab6b03a466023c26019d6202965e02965e02a46602ab6b03"
+          "7449028453027a4c02a466024f3101845302563601744902845302704601ab6b039d62027a4c02ab6b03ab6b035a3801704601482d019d6202905a028453028a5602ab6b03ab6b03623d014c2f01905a028453029d62028a5602a466029d6202"
+          "4f31018a56023a2401ab6b03905a027f4f026640019d62027449027a4c027a4c022e1c009d6202965e026b4301241600ab6b03ab6b03744902965e022a1a006b4301482d016b43013f2701905a02a46602ab6b03905a025a3801744902372200"
+          "a46602ab6b03a466023c2601ab6b03905a028a56028453027449028a56025e3b017f4f02704601ab6b039d6202482d013a24018a56024c2f01965e02ab6b034c2f01704601a466028453027f4f02845302ab6b03965e025636015233017f4f02"
+          "a466025a38014c2f01ab6b033c26017a4c02965e02a46602965e02ab6b03a466027f4f02a46602ab6b036640018a5602965e02664001905a02965e027a4c026b43019d6202905a028a56029d6202905a02965e02623d01a46602704601a46602"
+          "965e02523301704601965e02965e024c2f015e3b01905a02ab6b03a46602623d01965e029d6202965e026640017f4f02563601a466029d6202905a02965e02a46602905a02905a025a3801ab6b034f3101a46602905a029d62027f4f02523301"
+          "623d017046016b43017046016b4301744902ab6b035e3b01a46602744902965e02704601965e02ab6b03ab6b03a466023c26015e3b016b4301482d01ab6b03ab6b038a56027046010c07008a5602a46602845302704601a466028a5602965e02"
+          "7449029d6202965e02965e027046019d6202a466026640018a5602965e025a3801965e02905a02905a02321f00965e02704601ab6b03905a02ab6b03905a027a4c027a4c027a4c02",
+          "01966a01966a01966a01916f01916f018b75018b75018b7501867a01867a01817f01817f017b85017b85017b8501768a01768a01718f01718f016b95016b95016b9501669a01669a01619f01619f01619f015ba5015ba50156aa0156aa0151af"
+          "0151af0151af014bb5014bb50146ba0146ba0141bf0141bf0141bf013bc5013bc50136ca0136ca0136ca0131cf0131cf012bd5012bd50126da0126da0126da0121df0121df011be5011be50116ea0116ea0116ea0111ef0111ef010bf5010bf5"
+          "0106fa0106fa0106fa0101ff0101ff0201fd0201fd0201fd0501fa0501fa0801f70801f70a01f50a01f50a01f50d01f20d01f21001ef1001ef1201ed1201ed1201ed1501ea1501ea1801e71801e71801e71a01e51a01e51d01e21d01e22001df"
+          "2001df2001df2201dd2201dd2501da2501da2801d72801d72801d72b01d42b01d42d01d22d01d22d01d23001cf3001cf3301cc3301cc3501ca3501ca3501ca3801c73801c73b01c43b01c43d01c23d01c23d01c24001bf4001bf4301bc4301bc"
+          "4501ba4501ba4501ba4801b74801b74b01b44b01b44b01b44d01b24d01b25001af5001af5301ac5301ac5301ac5501ab5501ab5701a95701a95a01a65a01a65a01a65d01a35d01a35f01a15f01a15f01a162019e62019e65019b65019b670199"
+          "6701996701996a01966a01966d01936d01936f01916f01916f019172018e72018e75018b75018b75018b7701897701897a01867a01867d01837d01837d018380018080018082017e82017e85017b85017b85017b8801788801788a01768a0176"
+          "8d01738d01738d017390017090017092016e92016e92016e95016b95016b9801689801689a01669a01669a01669d01639d0163a00160a00160a2015ea2015ea2015ea5015ba5015ba80158a80158a80158aa0155aa0155ac0153ac0153af0150"
+          "af0150af0150b2014db2014db4014bb4014bb70148b70148b70148ba0145ba0145bc0143bc0143bc0143bf0140bf0140c2013dc2013dc4013bc4013bc4013bc70138c70138ca0135ca0135cc0133cc0133cc0133cf0130cf0130d2012dd2012d"
+          "d5012ad5012ad5012ad70128d70128da0125da0125da0125dd0122dd0122df0120df0120e2011de2011de2011de5011ae5011ae70118e70118ea0115ea0115ea0115ed0112ed0112ef0110ef0110ef0110f2010df2010df5010af5010af70108"
+          "f70108f70108fa0105fa0105fd0102fd0102ff0101ff0101ff0101fd0201fd0201fa0501fa0501fa0501f70801f70801f50a01f50a01f20d01f20d01f20d01ef1001ef1001ed1201ed1201ea1501ea1501ea1501e71801e71801e51a01e51a01"
+          "e21d01e21d01e21d01df2001df2001dd2201dd2201dd2201da2501da2501d72801d72801d42b01d42b01d42b01d22d01d22d01cf3001cf3001cc3301cc3301cc3301ca3501ca3501c73801c73801c73801c43b01c43b01c23d01c23d01bf4001"
+          "bf4001bf4001bc4301bc4301ba4501ba4501b74801b74801b74801b44b01b44b01b24d01b24d01b24d01af5001af5001ac5301ac5301ab5501ab5501ab5501ab5701ab5701ab5a01ab5a01ab5d01ab5d01ab5d01ab5f01ab5f01ab6201ab6201"
+          "ab6501ab6501ab6501ab6701ab6701ab6a01ab6a01ab6a01ab6d01ab6d01ab6f01ab6f01ab7201ab7201ab7201ab7501ab7501ab7701ab7701ab7a01ab7a01ab7a01ab7d01ab7d01ab8001ab8001ab8001ab8201ab8201ab8501ab8501ab8801"
+          "ab8801ab8801ab8a01ab8a01ab8d01ab8d01ab9001ab9001ab9001ab9201ab9201ab9501ab9501ab9501ab9801ab9801ab9a01ab9a01ab9d01ab9d01ab9d01aba001aba001aba201aba201aba501aba501aba501aba801aba801abaa01abaa01"
+          "a6ac01a6ac01a6ac01a1af01a1af019bb2019bb2019bb20196b40196b40191b70191b7018bba018bba018bba0186bc0186bc0181bf0181bf017bc2017bc2017bc20176c40176c40171c70171c70171c7016bca016bca0166cc0166cc0161cf01"
+          "61cf0161cf015bd2015bd20156d50156d50151d70151d70151d7014bda014bda0146dd0146dd0146dd0141df0141df013be2013be20136e50136e50136e50131e70131e7012bea012bea0126ed0126ed0126ed0121ef0121ef011bf2011bf201"
+          "16f50116f50116f50111f70111f7010bfa010bfa010bfa0106fd0106fd0101ff0101ff0101fd0201fd0201fd0201fa0501fa0501f70801f70801f50a01f50a01f50a01f20d01f20d01ef1001ef1001ef1001ed1201ed1201ea1501ea1501e718"
+          "01e71801e71801e51a01e51a01e21d01e21d01df2001df2001df2001dd2201dd2201da2501da2501da2501d72801d72801d42b01d42b01d22d01d22d01d22d01cf3001cf3001cc3301cc3301ca3501ca3501ca3501c73801c73801c43b01c43b"
+          "01c23d01c23d01c23d01bf4001bf4001bc4301bc4301bc4301ba4501ba4501b74801b74801b44b01b44b01b44b01b24d01b24d01af5001af5001ac5301ac5301ac5301ab5501ab55" } },
+    { "layers", 600, 0x08886867, {
+          "bcb2a0b09e81fffacfebc88dffffe2ffffb7ffffe2ffffecfff99affffa8ffffe2fffdbeffffe1dac6a7c0b4a0fffff5e9e5e1989493c5bebecfc6c6bdb6b6dadad5828181eeecebf5f1ebf5ede1fffff59e8967ffffebffde99ffffbfffd177"
+          "ffffffffffc7fffff6fffca8ffffecffffd8ffffebb9a78dc0b7a76f6a62c3c1beb7b6b6d8d8d8e1e1e1818181f5f5f58e8d8dacaaa7e5e0d8faf1e1fbe9cfffffffffffcfffffffffd07cfff79affffb7ffffbfffffecffffffffffc6b29462"
+          "edd8b6ffffebfffff5f5f1ebe4e2e1bfbebebebebeffffffe1e1e1d9d8d8dbd9d8afaba7fffff58c806cffffe1fff4c6ffffffffffd9ffffecfffff6ffffaff0b657ffea94ffffe2b49156ecd2a7ffffffafa593ffffffffffffb8b7b6c6c6c6"
+          "e1e1e1bebebe4e4e4ebfbebee5e3e1726d67978f81cfbfa7ffffffeece99ffffecffffc7ffffffffffbfffef8ef0b75bffffffffffffffffffffffe1c8b8a0ffffffb9b4aeaba9a7f6f5f5ebebebffffff5e5e5ebebebef7f6f5fcf9f5807a71"
+          "c3b9a7ffffebffffe1fff9beffd78effffe2ffe788ffffffffdb7cffda82ffffec643f00fffff5dac6a7e6dac6878076ffffffffffffffffffaeaeaeebebebb6b6b6ffffffeeecebaaa6a0e3dbcffffff5d7c2a0ffffd8ffffcfffffffffffe2"
+          "ffe282ffffa8fff79affffafffffbfe0be87ad956cfffff5cfc6b6ada8a0ffffffd0cfcfa7a7a7878787a7a7a7f5f5f5ffffffacaaa788837b605747f2e0c6d4bc93ffe5aeffffd9ffee9ae9b053ffffb7ffffe2ffffbfffffbfffffebfffff5"
+          "edd8b6fceed8ada599f5f1ebffffffd9d8d85a5a5ae1e1e1c6c6c6b7b6b6fffffffdf9f5e0d9cfada18dffeecfac9062cba667ffffd9ffffbfffffb7cf932ffff394edb963ffdd94ffe2a7dec499ddcbaeffffffffffffa7a4a0959493d8d8d8"
+          "ffffffcfcfcfebebebc7c6c6c2c0bec1bcb6fff9ebfffff5fae3befcdca7ffffecfffff6ffffd9ffffa1ffd372ffffb7ffffe2ffffd9eece99ffffebffffff160e00dad5cfb2b0aeffffffffffff8d8d8db6b6b6a0a0a0dad9d86966623d372e"
+          "a99f8dfff5d8fffffffffffffffff6ffffe2fffff6ffffffffe788ffffd9fffbafffffc6ffffe1ffeecff8ecd8e9e2d8797571595756e2e1e1bebebea7a7a7ebebebbfbebee4e2e1d9d5cf958d81f3e5cffffffff0d2a0ffffc6ffffd9ffe288"
+          "ffffe2ffffd9fffff6ffffd9fff6affffff5ffffd8ead8befaf1e1ffffffb3b1aed9d8d8ffffffd8d8d8f5f5f5ffffff828181faf8f5fffdf59a9181fffbe1ffffe1ffedb6ffffd0fffff6fffea1ffffe2ffffbfffe288daaa5bf6cf8dfff0be"
+          "fffff5eadcc6bbb3a7ffffffc9c7c69a9999ebebebf5f5f55e5e5effffffaaa8a7b6b2aea49d93fffffffffff5b69a6cffffc6ffffd9ffffafffffaffffffffffff6fffffffffff6ffffebb1976cfffee1fffff5ffffff888581dad9d8ffffff"
+          "cfcfcff5f5f5e1e1e1d0cfcfa4a2a0c9c4bea39b8de6d6bea8916cfffbc6ffffd0c1903fffffecffffafffffbfffd377ffffc7ffffe2ffffd8ad9671fffff58c8476fffbf5efedebe2e1e1626262e1e1e1a0a0a0b6b6b6dad9d8d6d3cff0eae1"
+          "fffdebfff5d8fff1c6c09d62ffffbfffffc7ffffc7ffffa1ffffa1ffffffd6a75bf7d293ffecbeb4a081f8ecd8928b81d7d3cfe4e2e1d9d8d8767676f5f5f5a7a7a76d6c6c615f5ef5f1ebffffffeadcc6fffff5d1b381fffff5ffffc7ffffd0"
+          "ffffc7fffd9affffd9fffff6daaf68ffffcffff8cf614f35e8dfcffffffff0eeebc7c6c6cfcfcfcfcfcfcfcfcffffffff6f5f5fffffff8f3ebfffbebfffbe1ffefc6ffedb6ffffbffffffff5bc5ffffff6fffa9affffc7fffff6ffe2a0fff0be"
+          "fff1cf90826cada5997b7771eeeceba1a0a0f5f5f5b6b6b6ffffffe2e1e1ffffff9b9793fcf5ebffffeba99576ffffd8ffffd8ffffd9ffe088ffffc7d99d39fffff6ffffd0ffffc7ffffffffffebfff5d8a99f8dffffff9a9793e3e2e1d8d8d8"
+          "818181b6b6b6ffffffecebebd3d1cfece7e1fffff5998971fffdd8ffffe1ffe4a1ffffffffffb7ffffa1ffffd0fffff6ffffecfffab7ffffffd5be99c1b199fff9eba49f99918f8de2e1e15e5e5ef5f5f5cfcfcf6c6c6cedecebf2efebfffef5"
+          "dad0beffffebffffffffffebffeaa1ffffecffffe2ffffbfffffd9ffffc7ffffecfffffffffff5ffffeb9b8f7bfffffff3efebaaa8a7bfbebe444444c6c6c6a7a7a7828181dbd9d8b1ada7a79f93e2d4beffffe1fff0beeac381ffffffffffe2"
+          "fffffffff794fffff6ffffecfffff6ffffebc8b087b3a187ffffffe5e0d83d3b38f6f5f5e1e1e1939393bebebeffffffb7b6b6f0eeeb57524a574e3efbe9cfffffebffffffffffd0ffffffffe588ffffffffffbfffc76dffe394dfb876fffff5"
+          "ffffe19f917bfffff5918d87dbd9d8e2e1e1767676f5f5f5ffffff9a9999eeecebc6c2bed7d0c68c806cdac6a7fffff5dfba7bffffd0ffffafffffffffc763ffffffffffbfffffe2",
+          "ebd7bdfff6befffff095754effffe7e2c9a8ffffefdadaddffffffffffffffffffffffffffffffffffffffffefffffe5d9afb2ffffddf1ce9bffffffdac5a8c9b190ffffd5fffbb5ffffddfffff0dfcdb5fff2bdfffcefd3ba9be8cda9fffff9"
+          "f1dbbdc8b49bffffe6fffffffffee6fffffff5debebcab96f1dbbdd7bc97fffff9fff5e6fffcc4ffffe6ffffdeffffd591611effffccfff7d5fffbdd8f7f6d8c6c42b0a9a1b59d7bffffeff2dcbdffffffd4c3aefffffffffff9e6d4bdffffe7"
+          "74747befdabd777376c7ac8afaf1e6fff5c4ffffffffffefffffe6daad6deed3aefffff9dcc6a8fff2bdffffeffffffff5eee6ffffddffffefe6d1b5ffffffb7a48aececeff6f6f9fffce6c4b19bc1c0c4fffffffffdddf0d5aefef4e6ffffcc"
+          "86735dfff5d5ffffffffffccffffddffffddffffccfffff0e8c89bfffff95e4425ffffe7ffffddfffff0ffffffffffffd0d0d5ffffffedecefffffeffff9ddfffff0ffffeffffff9fffff08f6a37fffbddfff6b5ffffccfffffaffffbdffe09c"
+          "ffffd5fffff9ffffffaa8a62b39c7bfdfaf9f9f8f9ffffeff6f6f9f4e0c4ffffefdbc8ae6a6971ffebcca89680ffffeffffff9fffff9deb985ffffd5fffff9ffffc4bba380ffffc4e9d1aedac5a8ffffddb08e5d9d7d53fffff9ffffe6ffffe6"
+          "fbe4c4ffffeffff4ddad9e8afff1d5e4d3bdf5e1c4fffff9ffffffe7cda8fffff99b9085fffbe6ffffe6ecd5b5fffff9ffffe6a47839ffd696f5ce96a39380b99869876f50a88d69ffefccffffffe7d5bdd2ba9cc3af96e5ceafececefaaa9ae"
+          "b09c80b4b2b5fffffafffff9fff2c4ffe6b5e0bd8afffff9ffffe6ffffffffffddfffcbdfacd8bffffddfffffffffff96b6461fffbd5ffeed5f8f7f9fffffff2ebf6f2ebf6bf8fb2fffff5fffff9fffffff2efefede9e6ffffe6fffeeffffff9"
+          "d7ad72fae4c4ffffe6ffffd6ffffccffffbee7d2b5ffffc4fff8ccf1e8ddfffdddfffffffffffffff5d56c5b4a89899083838affffdeffffffffffffb9a385876e4eeedabd856b4afbdcaeeadac4decaaeffffccffffe6f7c780ffffd5ffffcc"
+          "fffffffff2dd8f6e42f5d7aedcd8d5ebd7bd9e8c76ffffdee2e2e695959baf9b80e9d3b5fffffff8f7f9fbf9f9ffffe6dec19be1d7ccffffffffffc4c39d65ffffe6fffff9ffffddfffffacba469fff2bdfffff9987950cfb390f9e0bddedcdd"
+          "a898856f5b48fffff9f8e5cce7d2b5fffffafffbddd4c4aeffffff5d4628fffff9ffffeffffffffff3bdfffffffffffffff3ccebd2aefffff0fffffffff6bdffffe6ffebc4ffffff8a888af9f8f9ffffffffffefffffded0d0d5bfaf9bffffff"
+          "ffffefffedccebe7e6fff0cc7c736dffffffffe8aeffffd5ffffefffffffffffccf5c681fff5d5ffffcde6d7c4fffff9ffe7bddfc5a1fffff9fee6c5fffffffff3ddffffefaf9f8a606069ffffe6fffeddf2efefede9e6fffcd5e3d9ccdebb8a"
+          "fff8ddd4a969e9d1aedabf9bffffccbca485d8b076ffffffbb9b6ddfd6ccffedccfffff0f5e4cce8d3b5fffcddfffffad1ba9cffffff776553ffffeff7e2c4ffffe7ffe4bdfffffffffff9fff0b6fffff9ffeaaefffffffffffffae1bdffffff"
+          "855e2afffffffffff9eee5ddad987bf6debd76757bebd8bdd7c5aea4917becd8bdcbb497f3dfc4ffffff8c7a656e6a6de8cca88c6d45ffffe7fffff9fffdddffffe6ffffddfff2ccffffff735e45c29e69ffe9bdffffd8fbe2ddebdeebf5eef6"
+          "bd93acd1d0d555555dd4c1a8fff6ddd2bda1ebd8bdfff6d5fff2d5959190fffffafff5e6fff4bdffe0a2fffff9ffd896fffff9fffff9fffff9edd9bdffffd5ffffeff8daaedcc6a8c6c4c4644d31b8b8bdc8c7cc606069fffff9c0ab90b09b80"
+          "846e53fffff9ebe7e6fffff9fffbefe0bf90ffffe6ebc38addae6dfff8afe7cca8fffff9fffffffffffff9d7a8fffdccd2b48b554028ffffffd3bb9cffffff67553fffffefa8947bd9d9dda3a2a8a59076fae3c4ffffe6e3dcd5ffffdedecfbd"
+          "fffec4ffe0a8ffffffffffbdffffddf5c98affecb5926f3f695c50dfd6cc9d7f5bffedccffffefffffffffffeffae7ccfffde6fff9ddccb497fffff9ffffffc1ab8af6debdffffff493d34fff2bdffffd58a7356ffffefffffddfff6b5ffedcc"
+          "fff0b5cabaa8ffffddfffffffffdddfffff0a69176d3bea1f6f6f9bfbfc4dbc8aefffff9797880f8f7f9ffffdd484448fffbd5f3e9dd9a7748fbd297ffffffffffe6e6bd80ffffffffffbdfffff9fad9a8fffff0ffffddfef6efffffe6ffffe6"
+          "fffffffffff9fffffffffaddac977bafafb542424ae5ceae969396d3bea1fffff9e5dacce2bf90ffffefffffe6ffd590dac09bffffe7ffe5a1fffbddfffffffff5ccfffffffffff9ffffde9b8871fffffffff0d5c6b196fffffffce5c5ffffef"
+          "967f62bea685d9c3a8fcf5efd5ba96fffffffffff9ffffddffffffffffc4ffffffffffffffffffffffddffffddfedeae817a76ffffdefff7d5cebda8fffff9c1b09bfffff9fff9dd",
+          "ffe8c3fff29bffffd4fff6aeffffc4ffd784ffffafe8bd7fffe0b4ffffc4ffffa2fffff8ffffc4ffffffffffffffffeefffff7fffafffffffffffffffffffffffeccffffe6ffffb66d522ffffffff1bb6cffffffffffddffffa8ffffc4ffffff"
+          "ffffffffffb5fff7cbc9b194ffffefffffc4fffff0ffffbdc7b9acffffefffffffd3b58effffffffffe6ffffe6ffffffffffe6ffffd4ffc97affffffffffefffffeffffdaefff2d3ffffd3fffff8ffffdeffcd7afffabcffffdcffea9bbda588"
+          "fffffffffffffffea7ffffcdffffc4ffe8c3ffffbcffffddffffeffff7bbffffccfff0a1ffffc4ffffffffffe6ffffffffeab4ffffffffffe5ffffffffe5a7fffae4c0a788ffffddffeacbffffd4ffffe5ffffffffc061ffffa2fffff9ffffc4"
+          "f8c77ffcd6a0ffffd4ffffffe5a74cffffffffffffffffc4ffffccf5b75cfffffffffffffff7cbfffffffffff9fffdbcf0cea0fff6a7e8aa4ffffcc3ffffccffffffffdfa6fff9b5ffffccfffff8e0d4cafffff9ffec95fffffffffff9ffffdd"
+          "b48a4eeec488ffffffffffc4fffff9ffffc4ffffffffffffffffccfffffff6bb64ffffffffffcdffffd4ffffffffffbcffffffffffbcffe0b4ffffe7d79f4cfffca1fffff7fffffffffffffffff9ffffccdcac68ffebd2f5dfc3ffffffffffcc"
+          "e7ac55ffda7fffffccfffff9ffefa7ffffeffffff9ffffd3fffff9fffffffffb9cffffbcffffeffffff9ffffffffffe6fffffff3c37ffff0a1fffea7ffffddffffffffffe6fffffafffff7ffffffffffafdaba8effe7b4fffde4ffe9a1ffffee"
+          "ffffeeffffc4ffffffffffe6a58863ffffdcfffff9fffff0ffe2a6ffffffd5ad74ffffddf7bf6cffffffffe5a7ffffe6fffff9ffffffffd489ffffc4ffffd3ffffeffffff8ffffeec6ad8effffffffffffffffffff9de8ffe7b0debc8effc97a"
+          "ffffdefffff8e1a64ffffff9fffff8ffffffffffc4fffffffcddb4ffffd5ffffeefff095fffff0ffffffffffd4ffffd4fffffffffffff6e8dbffffc5ffffe6fffff8e1b068ffffffffffb6ffffe6ffffbdfffffafffffffffcc3ffffffffffcd"
+          "ffffaea2907dffe39bffffffd99b40ffd075ffffb5ffffe6ffffbdfff6a7eecfa6ffffffffffffffd384ffffccffffdd8f8378fffff9fff7bbffffffeac48effffe6ffffe6e7b368ffffeffffffffff4bbffffdeffffddffffffc19658ffffef"
+          "ffe69bffebd2ffffeeeecfa6fffff8fff6c3ffffeefffffffffffff6d4a6ffffe7ffffe6ffffa8ffffeffffff9eae1dbd19b4cffffffffffddf9debbffe8cbfffff9ffffccfff2a7fffff9ffffffffffe6ffffffffecaeaf8c5bffffe5ffffdc"
+          "fffff9fffffffffff9ffffdcffd995ffffefc58526fff2a7ffffe6ffce7fffffffffffefcc913ae9b364fffffffffff8ffffb5ffffffd9bb94ffffefaf8140ffffdcffcf84fffff7bb9b6fffef90ffffe7fff4d3ffffb5ddc7adf5e4d2ffffff"
+          "ffffffffffdeffffbcffe2a1efd2adffffefb4761bffffc4ffffffffffaefdcd89ffffffffffddffffbcffffd4ffffffffffe6fffaa7ffffe5ffffdeffcb70ffffa2ffffe5fff9c3f3c584fff6a7ffffffffffc3ebd5bbffffeeffffddfffff8"
+          "ffffffffdb84d4a055ffffbcfffff0fffffffffffffffff9e8c594ffefa7a18c73f9c57affd576ffffefffffeeffffe7ffffd4ffffccd5aa6cffffc4ffdc89f4ca8effd995ffffe6ffffffffffd4d49e4fffffeffffff8ffffefffffefffffe6"
+          "fffffaffffffffffffffffffffa6edffffffffffffffecc3fffddcfffffffffff8ffffffffde8fffffccb39b7effffddffe485f8e9dbffffc4ffffcdffffd4ffffefffffffffffffffffbcfeca7ffff6c3fffff8ffffffeccca0ffffffffffff"
+          "e4b675e9b364ffffffffffd4fffffff8b859ffffe5ffffe6ffffffffffd4ffee9bffffffa6814effffddffffefffffded6b994ffffffffffddffdfa1ffffd5ffffffffffccffffccffffbcfffff9ffffd4d29740ffffdcfffddcffffddffffef"
+          "7d5a29ffffcbffffeec3a988ffffafffffffffffaec19352ffffbcffffffffffc4ffffccfffff9ffe4bbffffffffffffffffeeffffa7fffff9ffffccffffddffffddfec36cbd9357fffff8ffffefffffeeffffddffffddffffffffdc89ffffd4"
+          "fffdaefffff9ffffffffffe6ffffedcca46bffdc89ffffffffffffffffffffffffffeebbfffff8ffffb5ffe2a6fffffffffff9fffffffffff9ffd995ffffffffec95ffffe5ffe0adfffde4ffffeefffff8e4b470ffffc4ffffefffffffffea8f"
+          "ffffffa99379ffffffffffe6ffffcdffffddb3946bffdfa1ffffefffffbdf5d6adfffffffffff9fffffffffffffffffaffffffffe8c3ffffffaf874effffddffffe6ffffddffffffffffffffffe7ffffffffffccffffe7fffffaffffccffffef"
+          "ffffc4ffffffffffb5ffffbcffdeadffffbcfee4c3f2c789ad926fffffffffffa7fffffff1bb6cfff4c3fffff9ffffffffffeeffffffffffd3ffffffffffdeffffddffffffffffe6",
+          "39414a29414a36414a1d404042414a1435391f414439414a3b414a36414a42414a40414a32414a34414a36414a36414a32414a42414a39414a34414a42414a5f3f8d8c3eaf753eaf803eaf59406d39414a22374a3b414a3d414a25394a1d304a"
+          "34414a3d414a3d414a3d414a34414a2e3f4a40414a36414a26354a3b414a36414a2e3b4a3d414a42414a40414a323d4a3d414a303a4a343d4a363f4a262f4a39404a282f4a3d414a1b204a2b2f4a1d214a262b4a393c4a3d414a36384a32344a"
+          "28284a36374a3b3b4a1e1d4a3b3a4a19184a42414a39384a2c2a4a2e2c4a38364a3f3d4a3b384a42414a403d4a3e3a4a35324a302c4a42414a42414a3f3a4a312c4a423d4a3b364a423d4a42414a423d4a38324a2c254a2f274a2f274a42414a"
+          "423f4a40384a42414a423f4a3f364a42384a42384a423d4a190f4a2e234a423d4a2e234a21154a423d4a423d4a42364a3b2e4a2a1d4a33254a20134a423a4a42364a42334a23144a42364a423f4a3b2c4a423f4a36254a423d4a301f4a42414a"
+          "35244a42414a423d4a423f4a261349423f4a2c194a42304a42364a2c194a38244a42334a3f2a4a3d284a42414a42364a423d4a321c4a423f4a3f284a423a4a341d4a423a4a42364a2c14453f274a42304a42334a423d4a42414a42334a42284a"
+          "42334a42364a423a4a423a4a423d4a3c214a422e4a42304a42384a3f234a423d4a422e4a422c4a423d4a422e4a42304a3e204a42384a423f4a42384a423a4a42384a42244a423d4a42304a3a194042414a422e4a42364a42334a42204642304a"
+          "423f4a42304a42214642284a423f4a42334a42324a422e4a423a4a42334a422e4a42414a421d3f42364a401a3c42334a422e4a423f4a422849421b3b42414a422444423f4a422443422341422544423d4a423f4a423a4a7323858e2daf8e37af"
+          "8e2daf5c3b6d42414a42334a42414a42414a42233d42183242364a423f4a42384a42414a42414a422c45423f4a422a4342243c42334a422c43423047423d4a423d4a423a4a423a4a423f4a423d4a42414a422136423d4a423044421d31423d4a"
+          "422e4142414a421124423042423d4a423648422e3f423648423849423849422738422738423d4a42414a423241423f4a423a49423a4942334242303e42303e420b1942303d423d4a423a47421f2b423d49423f4a422430423d4842212c422732"
+          "422a3542323c423a4442303a422832422c3542384142252f42363f423d4642242d422b33423e4642232c423e4642414842232a422128424046423d43423d4342353b423c4142323742303542313542414842313542373b42373b422225424146"
+          "421719423639423335424146424146423131424148423e3f42414842414842414842353542403f42363542414a423a3942414a42414142414142211e423c3942282542414642414142414142414a42332f42414a423c3742312c42414342413b"
+          "423f3942414642414a423029423e3742414142414842414842413b42413f42413d423a304241413f251c42414142414a424143424139424146423d3142414842413742414642413b424148424139412d1f42414642414142413f42413942413d"
+          "42414642414a42413f423c2c424148424148424137424139424130423c2a42414342413d42382542413d42414142414342414a42414a42414342414642413142414842412d4241413d321c42413142413b42414a42413542414642413b41371f"
+          "42414842414142412f42414a424146733f8d8e3ea88e3eaf8e3e925c405442413542414342413d42414342412d42412842413f42414842413b42414842413142413142414338351742414842413942414842413d42413742413d42412342412a"
+          "42414a42412c41412142414642414a42414a42413b42414a42413d42413942414342414142413542413b42412a42414642413042413d42413742413d37412142413942412f42413742413f33412042414142414142413f3741264241462f4120"
+          "42414642414842414a42413b38412c40413337412c4241433d413142414a26411c42413f42413f42413d40413928412137413139413338413342414a27412237413342414142414a1c411a3241313941393241314241483a413b354137424148"
+          "4241483541392d41302c41302f413333413933413931413742414a23412a3d414642414a34413d2941324041483b414442414a2e41382941333d41483b41453d41483d414930413c30413c3d41493b41471d41292541313d414a184125324140"
+          "3d414a1f412d36414534414340414a1a412928413840414a29413942414a42414a39414a3241432d413e2141323b414a3241452d413f34414736414a40414a2e41422e414242414a13412719412e40414a3b414a29413f39414a30414740414a"
+          "29414042414a40414a36414a42414a3d414a34414a2d41453b414a39414a34414a42414a16413042414a3d414a2b41463b414a21413c34414a28414422413e36414a34414a284145" } },
+};
@@ -0,0 +1,136 @@
+/**
+ * @file test_golden.cpp
+ * @brief Golden-frame regression tests for LEDPatterns
+ *
+ * Every scenario of golden.h is rendered at every strip length and its
+ * sampled frames are compared with those recorded in golden_frames.h. A
+ * kernel rewrite passes if no channel of any sampled frame is more than
+ * GOLDEN_MAX_CHANNEL_ERROR off; whether it is still bit-exact (the hash
+ * of every frame matches) is reported either way. FixedLEDPatterns<N> must
+ * render exactly the same frames as LEDPatterns.
+ *
+ * Run with: pio test -e native
+ * Record new frames, only after checking that a change in output is intended:
+ *     pio run -e native && .pio/build/native/program --update-golden > test/test_golden/golden_frames.h
+ */
+
+#include <unity.h>
+
+#include "golden.h"
+#include "golden_frames.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+/**
+ * @brief Largest difference allowed in any channel of a sampled frame
+ *
+ * Small enough to catch a broken kernel, large enough for a rewrite that
+ * rounds differently. Build with -D GOLDEN_MAX_CHANNEL_ERROR=0 to require
+ * bit-exact frames.
+ */
+#ifndef GOLDEN_MAX_CHANNEL_ERROR
+#define GOLDEN_MAX_CHANNEL_ERROR 3
+#endif
+
+namespace {
+
+// Case the test functions run on (Unity test functions take no arguments)
+int currentScenario = 0;
+uint16_t currentLeds = 0;
+
+GoldenRun run;
+GoldenRun fixedRun;
+char message[160];
+
+const GoldenCase* findGolden(const char* name, uint16_t numLeds) {
+    for (const GoldenCase& golden : GOLDEN_FRAMES) {
+        if (golden.numLeds == numLeds && strcmp(golden.name, name) == 0) {
+            return &golden;
+        }
+    }
+    return nullptr;
+}
+
+uint8_t hexByte(const char* hex) {
+    char digits[3] = { hex[0], hex[1], 0 };
+    return (uint8_t)strtoul(digits, nullptr, 16);
+}
+
+/**
+ * Largest channel difference between a frame and a recorded one
+ *
+ * @param worstLed Receives the LED where it occurs
+ */
+uint8_t maxChannelError(const CRGB* frame, const char* recorded, uint16_t numLeds, uint16_t& worstLed) {
+    uint8_t worst = 0;
+    worstLed = 0;
+    for (uint16_t i = 0; i < numLeds; i++) {
+        for (uint8_t c = 0; c < 3; c++) {
+            int error = abs((int)frame[i].raw[c] - (int)hexByte(recorded + i * 6 + c * 2));
+            if (error > worst) {
+                worst = error;
+                worstLed = i;
+            }
+        }
+    }
+    return worst;
+}
+
+void testMatchesGolden() {
+    const char* name = goldenScenarioName(currentScenario);
+    const GoldenCase* golden = findGolden(name, currentLeds);
+    TEST_ASSERT_NOT_NULL_MESSAGE(golden, "no recorded frames (run --update-golden)");
+    TEST_ASSERT_TRUE_MESSAGE(runGoldenScenario(currentScenario, currentLeds, false, run), "arena too small");
+
+    for (uint8_t sample = 0; sample < GOLDEN_SAMPLES; sample++) {
+        TEST_ASSERT_EQUAL_UINT32(currentLeds * 6, strlen(golden->samples[sample]));
+
+        uint16_t worstLed = 0;
+        uint8_t error = maxChannelError(run.samples[sample], golden->samples[sample], currentLeds, worstLed);
+        snprintf(message, sizeof(message), "frame %u, LED %u is %u off",
+                 (unsigned)((sample + 1) * GOLDEN_SAMPLE_INTERVAL - 1), (unsigned)worstLed, (unsigned)error);
+        TEST_ASSERT_TRUE_MESSAGE(error <= GOLDEN_MAX_CHANNEL_ERROR, message);
+    }
+
+    if (run.hash != golden->hash) {
+        snprintf(message, sizeof(message), "%s at %u LEDs: within tolerance, but not bit-exact", name,
+                 (unsigned)currentLeds);
+        TEST_MESSAGE(message);
+    }
+}
+
+void testFixedMatchesRuntime() {
+    TEST_ASSERT_TRUE_MESSAGE(runGoldenScenario(currentScenario, currentLeds, false, run), "arena too small");
+    TEST_ASSERT_TRUE_MESSAGE(runGoldenScenario(currentScenario, currentLeds, true, fixedRun), "arena too small");
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE(run.hash, fixedRun.hash, "FixedLEDPatterns renders different frames");
+}
+
+} // namespace
+
+void setUp() {
+}
+
+void tearDown() {
+}
+
+int main() {
+    UNITY_BEGIN();
+
+    char name[64];
+    for (uint16_t numLeds : GOLDEN_LED_COUNTS) {
+        for (int scenario = 0; scenario < GOLDEN_SCENARIOS; scenario++) {
+            currentScenario = scenario;
+            currentLeds = numLeds;
+
+            snprintf(name, sizeof(name), "golden_%s_%u", goldenScenarioName(scenario), (unsigned)numLeds);
+            UnityDefaultTestRun(testMatchesGolden, name, __LINE__);
+
+            snprintf(name, sizeof(name), "fixed_%s_%u", goldenScenarioName(scenario), (unsigned)numLeds);
+            UnityDefaultTestRun(testFixedMatchesRuntime, name, __LINE__);
+        }
+    }
+
+    return UNITY_END();
+}
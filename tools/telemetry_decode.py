@@ -0,0 +1,145 @@
+#!/usr/bin/env python3
+"""Decode the binary telemetry stream written by src/Telemetry.cpp.
+
+Each record is a COBS frame delimited by 0x00 bytes: the packed
+TelemetryRecord (include/Telemetry.h) followed by its CRC-16/CCITT-FALSE,
+little-endian. Anything between delimiters that is not a valid frame (boot
+messages, profile reports) is passed through as text on stderr.
+
+Examples:
+    telemetry_decode.py /dev/ttyUSB0 > log.csv        # live, needs pyserial
+    telemetry_decode.py capture.bin > log.csv         # raw capture file
+"""
+
+import argparse
+import binascii
+import csv
+import struct
+import sys
+
+RECORD_SENSOR = 1
+
+# Keep in sync with struct TelemetryRecord in include/Telemetry.h
+RECORD_FORMAT = "<BBIIhhBBBBIHHHBIH"
+RECORD_FIELDS = [
+    "type",
+    "flags",
+    "sample_time_us",
+    "sample_sequence",
+    "presence_value",
+    "motion_value",
+    "presence_intensity",
+    "motion_intensity",
+    "combined_intensity",
+    "pattern",
+    "frame_start_us",
+    "frame_work_us",
+    "show_us",
+    "estimated_ma",
+    "brightness",
+    "overrun_count",
+    "dropped_records",
+]
+RECORD_SIZE = struct.calcsize(RECORD_FORMAT)
+
+FLAG_PRESENCE = 0x01
+FLAG_MOTION = 0x02
+FLAG_POWER_LIMITED = 0x04
+FLAG_IDLE = 0x08
+FLAG_SENSOR_IDLE = 0x10
+
+# PatternType order in lib/LEDPatterns/src/Pattern.h
+PATTERN_NAMES = ["solid", "breathing", "gradient", "rainbow", "chase", "pulse", "fire", "twinkle", "field"]
+
+
+def cobs_decode(data):
+    """Decode one COBS block, or return None if it is malformed."""
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        code = data[i]
+        if code == 0 or i + code > len(data):
+            return None
+        out += data[i + 1:i + code]
+        i += code
+        if code < 0xFF and i < len(data):
+            out.append(0)
+    return bytes(out)
+
+
+def decode_frame(chunk):
+    """Return the record fields of a valid frame, or None."""
+    payload = cobs_decode(chunk)
+    if payload is None or len(payload) != RECORD_SIZE + 2:
+        return None
+    body, crc = payload[:RECORD_SIZE], struct.unpack("<H", payload[RECORD_SIZE:])[0]
+    if binascii.crc_hqx(body, 0xFFFF) != crc or body[0] != RECORD_SENSOR:
+        return None
+    return dict(zip(RECORD_FIELDS, struct.unpack(RECORD_FORMAT, body)))
+
+
+def open_source(path, baud):
+    """Open a serial port or a capture file for binary reading."""
+    if path == "-":
+        return sys.stdin.buffer
+    if path.startswith("/dev/") or path.upper().startswith("COM"):
+        import serial  # pyserial, only needed for live capture
+        return serial.Serial(path, baud, timeout=1)
+    return open(path, "rb")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("source", help="serial port, capture file, or - for stdin")
+    parser.add_argument("--baud", type=int, default=115200, help="serial baud rate (default 115200)")
+    parser.add_argument("--quiet", action="store_true", help="don't pass text output through to stderr")
+    args = parser.parse_args()
+
+    source = open_source(args.source, args.baud)
+    writer = csv.DictWriter(sys.stdout, fieldnames=RECORD_FIELDS[1:] + ["presence", "motion", "power_limited", "idle", "sensor_idle", "pattern_name"],
+                            extrasaction="ignore")
+    writer.writeheader()
+
+    pending = bytearray()
+    bad_frames = 0
+    while True:
+        data = source.read(256)
+        if not data:
+            if args.source.startswith("/dev/") or args.source.upper().startswith("COM"):
+                continue
+            break
+        pending += data
+
+        while True:
+            end = pending.find(b"\x00")
+            if end < 0:
+                break
+            chunk = bytes(pending[:end])
+            del pending[:end + 1]
+            if not chunk:
+                continue
+
+            record = decode_frame(chunk)
+            if record is not None:
+                record["presence"] = int(bool(record["flags"] & FLAG_PRESENCE))
+                record["motion"] = int(bool(record["flags"] & FLAG_MOTION))
+                record["power_limited"] = int(bool(record["flags"] & FLAG_POWER_LIMITED))
+                record["idle"] = int(bool(record["flags"] & FLAG_IDLE))
+                record["sensor_idle"] = int(bool(record["flags"] & FLAG_SENSOR_IDLE))
+                pattern = record["pattern"]
+                record["pattern_name"] = PATTERN_NAMES[pattern] if pattern < len(PATTERN_NAMES) else str(pattern)
+                writer.writerow(record)
+                sys.stdout.flush()
+            else:
+                text = chunk.decode("ascii", errors="replace")
+                if not (text.isprintable() or "\n" in text):
+                    bad_frames += 1
+                elif not args.quiet:
+                    sys.stderr.write(text)
+
+    if bad_frames:
+        sys.stderr.write("%d corrupt frames skipped\n" % bad_frames)
+
+
+if __name__ == "__main__":
+    main()